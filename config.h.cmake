@@ -35,6 +35,7 @@
 #define OXYGEN_FORCE_KDE_ICONS_AND_FONTS @OXYGEN_FORCE_KDE_ICONS_AND_FONTS@
 #define HAVE_DBUS @HAVE_DBUS@
 #define HAVE_DBUS_GLIB @HAVE_DBUS_GLIB@
+#define HAVE_XSHM @HAVE_XSHM@
 #define ENABLE_COMBOBOX_LIST_RESIZE @ENABLE_COMBOBOX_LIST_RESIZE@
 
 #define ENABLE_INNER_SHADOWS_HACK @ENABLE_INNER_SHADOWS_HACK@
@@ -0,0 +1,118 @@
+#!/bin/sh
+# this file is part of the oxygen gtk engine
+#
+# checks that shadow pixmaps are shared between processes, and remain valid when the owning process exits.
+# Runs two clients on a private Xvfb server, kills the one that owns the pixmaps, and checks that
+# - the survivor creates and publishes its own pixmaps, and installs them on its popup
+# - the owners list on the root window no longer contains the dead owner
+#
+# Requires Xvfb and xprop. The build must be configured with -DBUILD_SHADOW_TEST=1
+# Usage: oxygen-gtk-shadow-test.sh <build directory> [display]
+
+BUILD_DIR=${1:?usage: $0 <build directory> [display]}
+TEST_DISPLAY=${2:-:97}
+CLIENT="$BUILD_DIR/demo/oxygen-gtk-shadow-client"
+ENGINE="$BUILD_DIR/src/liboxygen-gtk.so"
+
+for file in "$CLIENT" "$ENGINE"; do
+    if [ ! -x "$file" ] && [ ! -f "$file" ]; then echo "missing $file"; exit 1; fi
+done
+
+TMP_DIR=$(mktemp -d)
+XVFB_PID=
+CLIENT_A=
+CLIENT_B=
+
+cleanup()
+{
+    for pid in $CLIENT_A $CLIENT_B $XVFB_PID; do kill $pid 2>/dev/null; done
+    rm -rf "$TMP_DIR"
+}
+trap cleanup EXIT
+
+fail()
+{
+    echo "FAIL: $*"
+    exit 1
+}
+
+# load engine from the build directory
+mkdir -p "$TMP_DIR/engines"
+ln -s "$(cd "$(dirname "$ENGINE")" && pwd)/$(basename "$ENGINE")" "$TMP_DIR/engines/"
+cat > "$TMP_DIR/gtkrc" << RC
+style "oxygen-test" { engine "oxygen-gtk" {} }
+class "*" style "oxygen-test"
+RC
+
+export GTK_PATH="$TMP_DIR"
+export GTK2_RC_FILES="$TMP_DIR/gtkrc"
+export DISPLAY=$TEST_DISPLAY
+
+Xvfb $DISPLAY -screen 0 640x480x24 -nolisten tcp > /dev/null 2>&1 &
+XVFB_PID=$!
+
+# wait for server
+for i in $(seq 50); do xprop -root > /dev/null 2>&1 && break; sleep 0.1; done
+xprop -root > /dev/null 2>&1 || fail "unable to start Xvfb on $DISPLAY"
+
+# pretend the window manager supports shadows
+xprop -root -f _NET_SUPPORTED 32a -set _NET_SUPPORTED _KDE_NET_WM_SHADOW
+
+# owner windows listed on the root window
+owners()
+{ xprop -root _OXYGEN_GTK_SHADOW_PIXMAPS | grep -o '0x[0-9a-fA-F]*'; }
+
+# round pixmaps advertised by owner window (values 2 to 9 of the payload)
+ownerPixmaps()
+{ xprop -id "$1" _OXYGEN_GTK_SHADOW_PIXMAPS | sed -n 's/.*= //p' | tr -d ' ' | cut -d, -f2-9; }
+
+# pixmaps installed on popup window (values 1 to 8 of the shadow property)
+shadowPixmaps()
+{ xprop -id "$1" _KDE_NET_WM_SHADOW | sed -n 's/.*= //p' | tr -d ' ' | cut -d, -f1-8; }
+
+# start client, and wait for its popup window id
+# client pid is stored in CLIENT_<name>, and popup window id in POPUP_<name>
+startClient()
+{
+    "$CLIENT" > "$TMP_DIR/$1" 2> "$TMP_DIR/$1.log" &
+    eval "CLIENT_$1=$!"
+    for i in $(seq 50); do [ -s "$TMP_DIR/$1" ] && break; sleep 0.1; done
+    [ -s "$TMP_DIR/$1" ] || fail "client $1 did not start"
+    sleep 0.5
+    eval "POPUP_$1=$(cat "$TMP_DIR/$1")"
+}
+
+# first client creates and publishes pixmaps
+startClient A
+OWNER_A=$(owners)
+[ $(echo "$OWNER_A" | wc -w) -eq 1 ] || fail "expected one pixmaps owner, got: $OWNER_A"
+PIXMAPS_A=$(ownerPixmaps $OWNER_A)
+[ -n "$PIXMAPS_A" ] || fail "no pixmaps advertised on owner $OWNER_A"
+[ "$(shadowPixmaps $POPUP_A)" = "$PIXMAPS_A" ] || fail "client A does not use its published pixmaps"
+echo "client A: popup $POPUP_A owner $OWNER_A"
+
+# second client reuses them
+startClient B
+[ "$(owners)" = "$OWNER_A" ] || fail "client B published pixmaps instead of reusing them: $(owners)"
+[ "$(shadowPixmaps $POPUP_B)" = "$PIXMAPS_A" ] || fail "client B does not use shared pixmaps"
+echo "client B: popup $POPUP_B uses pixmaps from $OWNER_A"
+
+# kill owner. Survivor must publish its own pixmaps and prune the dead owner
+kill -9 $CLIENT_A
+CLIENT_A=
+for i in $(seq 50); do
+    OWNERS=$(owners)
+    [ -n "$OWNERS" ] && ! echo "$OWNERS" | grep -q "^$OWNER_A\$" && break
+    sleep 0.1
+done
+
+echo "$OWNERS" | grep -q "^$OWNER_A\$" && fail "dead owner $OWNER_A was not pruned: $OWNERS"
+[ $(echo "$OWNERS" | wc -w) -eq 1 ] || fail "expected one pixmaps owner after handoff, got: $OWNERS"
+PIXMAPS_B=$(ownerPixmaps $OWNERS)
+[ -n "$PIXMAPS_B" ] || fail "no pixmaps advertised on new owner $OWNERS"
+[ "$PIXMAPS_B" != "$PIXMAPS_A" ] || fail "new owner advertises dead pixmaps"
+[ "$(shadowPixmaps $POPUP_B)" = "$PIXMAPS_B" ] || fail "client B did not re-install shadows with its own pixmaps"
+kill -0 $CLIENT_B 2>/dev/null || fail "client B exited"
+echo "client B: popup $POPUP_B now uses pixmaps from $OWNERS"
+
+echo "PASS"
@@ -0,0 +1,274 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+/*
+benchmark for widget data storage, as used by animation engines.
+Registers, looks up, iterates and unregisters widgets in several DataMap instances,
+one per simulated engine, and finally destroys the widgets while still registered.
+Usage: oxygen-gtk-datamap-benchmark [widget count] [engine count]
+*/
+
+#include "oxygendatamap.h"
+
+#include <gtk/gtk.h>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace Oxygen
+{
+
+    //! per widget data, similar in size to engines data
+    class BenchmarkData
+    {
+
+        public:
+
+        //! constructor
+        BenchmarkData( void ):
+            _value( 0 ),
+            _connected( false )
+        {}
+
+        //! connect
+        void connect( GtkWidget* )
+        { _connected = true; }
+
+        //! disconnect
+        void disconnect( GtkWidget* )
+        { _connected = false; }
+
+        //! value
+        long _value;
+
+        //! connection state
+        bool _connected;
+
+        //! padding, standing for timelines and signals
+        void* _padding[6];
+
+    };
+
+    //! benchmark
+    class DataMapBenchmark
+    {
+
+        public:
+
+        //! constructor
+        DataMapBenchmark( int widgetCount, int engineCount ):
+            _maps( engineCount ),
+            _errors( 0 )
+        {
+
+            for( int i = 0; i < engineCount; ++i )
+            { _maps[i] = new DataMap<BenchmarkData>(); }
+
+            for( int i = 0; i < widgetCount; ++i )
+            { _widgets.push_back( GTK_WIDGET( g_object_ref_sink( gtk_label_new( 0L ) ) ) ); }
+
+        }
+
+        //! destructor
+        virtual ~DataMapBenchmark( void )
+        {
+            for( MapList::iterator iter = _maps.begin(); iter != _maps.end(); ++iter )
+            { delete *iter; }
+        }
+
+        //! run all passes, returns number of errors
+        int run( void );
+
+        protected:
+
+        //! register all widgets in all maps
+        void registerWidgets( void );
+
+        //! lookup all widgets in all maps, alternating maps so that last widget caching does not apply
+        void lookupWidgets( void );
+
+        //! iterate over all maps
+        void iterate( void );
+
+        //! erase all widgets from all maps
+        void eraseWidgets( void );
+
+        //! destroy widgets while they are still registered
+        void destroyWidgets( void );
+
+        //! print elapsed time for given pass
+        void print( const char*, GTimer* ) const;
+
+        private:
+
+        //! maps
+        typedef std::vector<DataMap<BenchmarkData>*> MapList;
+        MapList _maps;
+
+        //! widgets
+        typedef std::vector<GtkWidget*> WidgetList;
+        WidgetList _widgets;
+
+        //! errors
+        int _errors;
+
+    };
+
+    //__________________________________________________________________
+    int DataMapBenchmark::run( void )
+    {
+
+        std::cout << "Oxygen::DataMapBenchmark - widgets: " << _widgets.size() << " engines: " << _maps.size() << std::endl;
+
+        GTimer* timer( g_timer_new() );
+
+        g_timer_start( timer );
+        registerWidgets();
+        print( "register", timer );
+
+        g_timer_start( timer );
+        lookupWidgets();
+        print( "lookup", timer );
+
+        g_timer_start( timer );
+        iterate();
+        print( "iterate", timer );
+
+        g_timer_start( timer );
+        eraseWidgets();
+        print( "unregister", timer );
+
+        // register again, to check that pooled nodes are reused properly
+        g_timer_start( timer );
+        registerWidgets();
+        print( "register again", timer );
+
+        g_timer_start( timer );
+        destroyWidgets();
+        print( "destroy", timer );
+
+        g_timer_destroy( timer );
+
+        std::cout << "Oxygen::DataMapBenchmark - errors: " << _errors << std::endl;
+        return _errors;
+
+    }
+
+    //__________________________________________________________________
+    void DataMapBenchmark::registerWidgets( void )
+    {
+        for( size_t i = 0; i < _widgets.size(); ++i )
+        {
+            for( MapList::iterator iter = _maps.begin(); iter != _maps.end(); ++iter )
+            { (*iter)->registerWidget( _widgets[i] )._value = i; }
+        }
+    }
+
+    //__________________________________________________________________
+    void DataMapBenchmark::lookupWidgets( void )
+    {
+        for( size_t i = 0; i < _widgets.size(); ++i )
+        {
+            for( MapList::iterator iter = _maps.begin(); iter != _maps.end(); ++iter )
+            {
+                if( !( (*iter)->contains( _widgets[i] ) && (*iter)->value( _widgets[i] )._value == long( i ) ) )
+                { ++_errors; }
+            }
+        }
+    }
+
+    //__________________________________________________________________
+    void DataMapBenchmark::iterate( void )
+    {
+        for( MapList::iterator iter = _maps.begin(); iter != _maps.end(); ++iter )
+        {
+            (*iter)->connectAll();
+
+            size_t count( 0 );
+            for( DataMap<BenchmarkData>::Map::iterator dataIter = (*iter)->map().begin(); dataIter != (*iter)->map().end(); ++dataIter )
+            { if( dataIter->second._connected ) ++count; }
+
+            if( count != _widgets.size() || (*iter)->map().size() != _widgets.size() ) ++_errors;
+            (*iter)->disconnectAll();
+        }
+    }
+
+    //__________________________________________________________________
+    void DataMapBenchmark::eraseWidgets( void )
+    {
+        for( size_t i = 0; i < _widgets.size(); ++i )
+        {
+            for( MapList::iterator iter = _maps.begin(); iter != _maps.end(); ++iter )
+            { (*iter)->erase( _widgets[i] ); }
+        }
+
+        for( MapList::iterator iter = _maps.begin(); iter != _maps.end(); ++iter )
+        { if( !(*iter)->map().empty() ) ++_errors; }
+
+        // widget registry records must have been released together with the last slot
+        if( WidgetRegistry::first() ) ++_errors;
+    }
+
+    //__________________________________________________________________
+    void DataMapBenchmark::destroyWidgets( void )
+    {
+        for( WidgetList::iterator iter = _widgets.begin(); iter != _widgets.end(); ++iter )
+        {
+            gtk_widget_destroy( *iter );
+            g_object_unref( *iter );
+        }
+
+        _widgets.clear();
+
+        // finalized widgets must have been removed from all maps
+        for( MapList::iterator iter = _maps.begin(); iter != _maps.end(); ++iter )
+        { if( !(*iter)->map().empty() ) ++_errors; }
+
+        if( WidgetRegistry::first() ) ++_errors;
+    }
+
+    //__________________________________________________________________
+    void DataMapBenchmark::print( const char* pass, GTimer* timer ) const
+    { std::cout << "  " << pass << ": " << g_timer_elapsed( timer, 0L )*1000 << " ms" << std::endl; }
+
+}
+
+//__________________________________________________________________
+int main( int argc, char** argv )
+{
+
+    if( !gtk_init_check( &argc, &argv ) )
+    {
+        std::cerr << "oxygen-gtk-datamap-benchmark - unable to initialize gtk" << std::endl;
+        return 1;
+    }
+
+    const int widgetCount( argc > 1 ? atoi( argv[1] ):10000 );
+    const int engineCount( argc > 2 ? atoi( argv[2] ):8 );
+    if( widgetCount <= 0 || engineCount <= 0 || engineCount > Oxygen::WidgetRegistry::MaxSlots )
+    {
+        std::cerr << "Usage: oxygen-gtk-datamap-benchmark [widget count] [engine count]" << std::endl;
+        return 1;
+    }
+
+    Oxygen::DataMapBenchmark benchmark( widgetCount, engineCount );
+    return benchmark.run() ? 1:0;
+
+}
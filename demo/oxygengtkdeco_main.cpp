@@ -84,10 +84,22 @@ enum Metric
     MetricsCount
 };
 
+//! button geometry and state, as expected by drawWindecoButtons
+struct ButtonData
+{
+    unsigned long type;
+    unsigned long state;
+    gint x;
+    gint y;
+    gint w;
+    gint h;
+};
+
 //___________________________________________________________________
 // external pointers to functions
 void (*drawWindowDecoration)(cairo_t*, unsigned long, gint, gint, gint, gint, const gchar**, gint, gint) = 0L;
 void (*drawWindecoButton)(cairo_t*, unsigned long, unsigned long, unsigned long, gint, gint, gint, gint) = 0L;
+void (*drawWindecoButtons)(cairo_t*, const ButtonData*, unsigned long, unsigned long) = 0L;
 void (*drawWindecoShapeMask)(cairo_t*, unsigned long, gint, gint, gint, gint) = 0L;
 void (*drawWindowShadow)(cairo_t*, unsigned long, gint, gint, gint, gint) = 0L;
 gint (*getWindecoABIVersion)(void) = 0L;
@@ -140,7 +152,7 @@ gboolean initLib()
                     break;
                 } else {
 
-                    #define EXPECTED_ABI_VERSION 3
+                    #define EXPECTED_ABI_VERSION 4
                     gint version=getWindecoABIVersion();
                     if(version != EXPECTED_ABI_VERSION)
                     {
@@ -160,6 +172,11 @@ gboolean initLib()
                 if((error=dlerror())!=0L)
                     break;
 
+                // store drawWindecoButtons symbol
+                drawWindecoButtons = (void (*)(cairo_t*, const ButtonData*, unsigned long, unsigned long))dlsym(library, "drawWindecoButtons");
+                if((error=dlerror())!=0L)
+                    break;
+
                 // store drawWindecoShapeMask symbol
                 drawWindecoShapeMask=(void (*)(cairo_t*, unsigned long, gint, gint, gint, gint))dlsym(library, "drawWindecoShapeMask");
                 if((error=dlerror())!=0L)
@@ -227,6 +244,9 @@ gboolean on_expose(GtkWidget* mw0, GdkEventExpose* event, gpointer user_data)
 
     drawWindowDecoration(cr, opt, 0+shadowLeft, 0+shadowTop, mw0->allocation.width-shadowLeft-shadowRight, mw0->allocation.height-shadowTop-shadowBottom, windowStrings, 0, 20*ButtonTypeCount);
 
+    // render all buttons in one call
+    ButtonData buttons[ButtonStatusCount*ButtonTypeCount];
+    int count=0;
     for( int status=0; status<ButtonStatusCount; status++)
     {
         for( int type=0; type<ButtonTypeCount; type++)
@@ -234,13 +254,18 @@ gboolean on_expose(GtkWidget* mw0, GdkEventExpose* event, gpointer user_data)
             int buttonSize=getWindecoButtonSize(type);
             int buttonSpacing=getWindecoMetric(ButtonSpacing);
             int dbut=buttonSize+buttonSpacing;
-            drawWindecoButton(cr, type, status, opt,
-                    mw0->allocation.width-shadowRight-borderRight-buttonSize-buttonSize*type,
-                    status*dbut+shadowTop+(borderTop-buttonSize)/2,
-                    buttonSize, buttonSize);
+            ButtonData& button( buttons[count++] );
+            button.type=type;
+            button.state=status;
+            button.x=mw0->allocation.width-shadowRight-borderRight-buttonSize-buttonSize*type;
+            button.y=status*dbut+shadowTop+(borderTop-buttonSize)/2;
+            button.w=buttonSize;
+            button.h=buttonSize;
         }
     }
 
+    drawWindecoButtons(cr, buttons, count, opt);
+
     cairo_destroy(cr);
     return TRUE;
 }
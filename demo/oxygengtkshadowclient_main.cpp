@@ -0,0 +1,61 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+/*
+minimal client for oxygen-gtk-shadow-test.sh.
+Shows a popup menu window, so that the engine installs shadows on it,
+prints its X11 window id on standard output, and runs until killed.
+*/
+
+#include <gtk/gtk.h>
+#include <iostream>
+
+#ifdef GDK_WINDOWING_X11
+#include <gdk/gdkx.h>
+#endif
+
+//__________________________________________________________________
+int main( int argc, char** argv )
+{
+
+    #ifdef GDK_WINDOWING_X11
+
+    gtk_init( &argc, &argv );
+
+    // popup window, with menu hint, as for menus
+    GtkWidget* window( gtk_window_new( GTK_WINDOW_POPUP ) );
+    gtk_window_set_type_hint( GTK_WINDOW( window ), GDK_WINDOW_TYPE_HINT_POPUP_MENU );
+    gtk_window_set_default_size( GTK_WINDOW( window ), 100, 100 );
+    gtk_widget_show( window );
+
+    // print window id once shown
+    std::cout << "0x" << std::hex << GDK_WINDOW_XID( gtk_widget_get_window( window ) ) << std::endl;
+
+    gtk_main();
+    return 0;
+
+    #else
+
+    std::cerr << "oxygen-gtk-shadow-client - X11 is required" << std::endl;
+    return 1;
+
+    #endif
+
+}
@@ -20,6 +20,7 @@
 */
 
 #include "oxygenanimations.h"
+#include "../oxygengtktypeflags.h"
 #include "../oxygengtkutils.h"
 #include "../oxygenqtsettings.h"
 #include "../config.h"
@@ -32,43 +33,41 @@ namespace Oxygen
 
     //_________________________________________
     Animations::Animations( void ):
+        _settings( 0L ),
+        _enabled( true ),
         _innerShadowsEnabled( true ),
-        _hooksInitialized( false )
+        _backgroundHintEngine( 0L ),
+        _comboEngine( 0L ),
+        _comboBoxEngine( 0L ),
+        _comboBoxEntryEngine( 0L ),
+        _dialogEngine( 0L ),
+        _flatWidgetEngine( 0L ),
+        _groupBoxEngine( 0L ),
+        _groupBoxLabelEngine( 0L ),
+        _hoverEngine( 0L ),
+        _mainWindowEngine( 0L ),
+        _menuItemEngine( 0L ),
+        _panedEngine( 0L ),
+        _scrollBarEngine( 0L ),
+        _scrolledWindowEngine( 0L ),
+        _innerShadowEngine( 0L ),
+        _tabWidgetEngine( 0L ),
+        _treeViewEngine( 0L ),
+        _widgetSizeEngine( 0L ),
+        _widgetStateEngine( 0L ),
+        _arrowStateEngine( 0L ),
+        _scrollBarStateEngine( 0L ),
+        _tabWidgetStateEngine( 0L ),
+        _treeViewStateEngine( 0L ),
+        _menuBarStateEngine( 0L ),
+        _menuStateEngine( 0L ),
+        _toolBarStateEngine( 0L ),
+        _hooksInitialized( false ),
+        _sizeAllocationHookInitialized( false )
     {
         #if OXYGEN_DEBUG
         std::cerr << "Oxygen::Animations::Animations" << std::endl;
         #endif
-
-        // create engines
-        registerEngine( _backgroundHintEngine = new BackgroundHintEngine( this ) );
-        registerEngine( _comboEngine = new ComboEngine( this ) );
-        registerEngine( _comboBoxEngine = new ComboBoxEngine( this ) );
-        registerEngine( _comboBoxEntryEngine = new ComboBoxEntryEngine( this ) );
-        registerEngine( _dialogEngine = new DialogEngine( this ) );
-        registerEngine( _flatWidgetEngine = new FlatWidgetEngine( this ) );
-        registerEngine( _groupBoxEngine = new GroupBoxEngine( this ) );
-        registerEngine( _groupBoxLabelEngine = new GroupBoxLabelEngine( this ) );
-        registerEngine( _hoverEngine = new HoverEngine( this ) );
-        registerEngine( _mainWindowEngine = new MainWindowEngine( this ) );
-        registerEngine( _menuItemEngine = new MenuItemEngine( this ) );
-        registerEngine( _panedEngine = new PanedEngine( this ) );
-        registerEngine( _scrollBarEngine = new ScrollBarEngine( this ) );
-        registerEngine( _scrolledWindowEngine = new ScrolledWindowEngine( this ) );
-        registerEngine( _innerShadowEngine = new InnerShadowEngine( this ) );
-        registerEngine( _tabWidgetEngine = new TabWidgetEngine( this ) );
-        registerEngine( _treeViewEngine = new TreeViewEngine( this ) );
-        registerEngine( _widgetSizeEngine = new WidgetSizeEngine( this ) );
-
-        // animations specific engines
-        registerEngine( _widgetStateEngine = new WidgetStateEngine( this ) );
-        registerEngine( _arrowStateEngine = new ArrowStateEngine( this ) );
-        registerEngine( _scrollBarStateEngine = new ScrollBarStateEngine( this ) );
-        registerEngine( _tabWidgetStateEngine = new TabWidgetStateEngine( this ) );
-        registerEngine( _treeViewStateEngine = new TreeViewStateEngine( this ) );
-        registerEngine( _menuBarStateEngine = new MenuBarStateEngine( this ) );
-        registerEngine( _menuStateEngine = new MenuStateEngine( this ) );
-        registerEngine( _toolBarStateEngine = new ToolBarStateEngine( this ) );
-
     }
 
     //____________________________________________________________________________________________
@@ -82,9 +81,15 @@ namespace Oxygen
         for( BaseEngine::List::iterator iter = _engines.begin(); iter != _engines.end(); ++iter )
         { delete *iter; }
 
-        // disconnect all signals from map
-        for( WidgetMap::iterator iter = _allWidgets.begin(); iter != _allWidgets.end(); iter++ )
-        { iter->second.disconnect(); }
+        // remove all destroy notifications and clear registered engines
+        for( WidgetRegistry::Record* record = WidgetRegistry::first(); record; )
+        {
+            GtkWidget* widget( record->_widget );
+            record->_engines = 0;
+            record = record->_next;
+
+            WidgetRegistry::removeDestroyNotify( widget, destroyNotifyEvent, this );
+        }
 
         // clear hooks
         _sizeAllocationHook.disconnect();
@@ -97,50 +102,12 @@ namespace Oxygen
     void Animations::initialize( const QtSettings& settings )
     {
 
-        const bool animationsEnabled( settings.animationsEnabled() );
+        // store settings, for engines created later
+        _settings = &settings;
 
-        // pass animations configuration to engines
-        _widgetStateEngine->setApplicationName( settings.applicationName() );
-        _widgetStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
-        _widgetStateEngine->setDuration( settings.genericAnimationsDuration() );
-
-        _arrowStateEngine->setApplicationName( settings.applicationName() );
-        _arrowStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
-        _arrowStateEngine->setDuration( settings.genericAnimationsDuration() );
-
-        _scrollBarStateEngine->setApplicationName( settings.applicationName() );
-        _scrollBarStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
-        _scrollBarStateEngine->setDuration( settings.genericAnimationsDuration() );
-
-        _tabWidgetStateEngine->setApplicationName( settings.applicationName() );
-        _tabWidgetStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
-        _tabWidgetStateEngine->setDuration( settings.genericAnimationsDuration() );
-
-        _treeViewStateEngine->setApplicationName( settings.applicationName() );
-        _treeViewStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
-        _treeViewStateEngine->setDuration( settings.genericAnimationsDuration() );
-
-        _menuBarStateEngine->setApplicationName( settings.applicationName() );
-        _menuBarStateEngine->setAnimationsEnabled( animationsEnabled && (settings.menuBarAnimationType() != NoAnimation) );
-        _menuBarStateEngine->setFollowMouse( settings.menuBarAnimationType() == FollowMouse );
-        _menuBarStateEngine->setDuration( settings.menuBarAnimationsDuration() );
-        _menuBarStateEngine->setFollowMouseAnimationsDuration( settings.menuBarFollowMouseAnimationsDuration() );
-
-        _menuStateEngine->setApplicationName( settings.applicationName() );
-        _menuStateEngine->setEnabled( animationsEnabled && (settings.menuAnimationType() != NoAnimation) );
-        _menuStateEngine->setFollowMouse( settings.menuAnimationType() == FollowMouse );
-        _menuStateEngine->setDuration( settings.menuAnimationsDuration() );
-        _menuStateEngine->setFollowMouseAnimationsDuration( settings.menuFollowMouseAnimationsDuration() );
-
-        // for now, only Fade animations mode is supported for toolbar animations
-        _toolBarStateEngine->setApplicationName( settings.applicationName() );
-        _toolBarStateEngine->setEnabled( animationsEnabled && (settings.toolBarAnimationType() != NoAnimation) );
-        _toolBarStateEngine->setFollowMouse(  settings.toolBarAnimationType() == FollowMouse );
-        _toolBarStateEngine->setDuration( settings.genericAnimationsDuration() );
-        _toolBarStateEngine->setFollowMouseAnimationsDuration( settings.toolBarAnimationsDuration() );
-
-        // background hint engine
-        _backgroundHintEngine->setUseBackgroundGradient( settings.useBackgroundGradient() );
+        // pass configuration to existing engines
+        for( BaseEngine::List::iterator iter = _engines.begin(); iter != _engines.end(); ++iter )
+        { configureEngine( *iter ); }
 
     }
 
@@ -155,25 +122,143 @@ namespace Oxygen
         { _innerShadowHook.connect( "realize", (GSignalEmissionHook)innerShadowHook, this ); }
         #endif
 
-        _sizeAllocationHook.connect( "size-allocate", (GSignalEmissionHook)sizeAllocationHook, this );
         _realizationHook.connect( "realize", (GSignalEmissionHook)realizationHook, this );
 
         _hooksInitialized = true;
+
+        // size allocation hook is only needed once comboboxes or groupbox labels are registered
+        if( _comboEngine || _comboBoxEngine || _comboBoxEntryEngine || _groupBoxLabelEngine )
+        { initializeSizeAllocationHook(); }
+
     }
 
     //____________________________________________________________________________________________
-    bool Animations::registerWidget( GtkWidget* widget )
+    void Animations::initializeSizeAllocationHook( void )
     {
+        if( !_hooksInitialized || _sizeAllocationHookInitialized ) return;
+        _sizeAllocationHook.connect( "size-allocate", (GSignalEmissionHook)sizeAllocationHook, this );
+        _sizeAllocationHookInitialized = true;
+    }
 
-        if( _allWidgets.find( widget ) != _allWidgets.end() ) return false;
+    //____________________________________________________________________________________________
+    void Animations::registerEngine( BaseEngine* engine )
+    {
 
-        #if OXYGEN_DEBUG
-        std::cerr << "Oxygen::Animations::registerWidget - " << widget << " (" << (widget ? G_OBJECT_TYPE_NAME( widget ):"0x0") << ")" << std::endl;
-        #endif
+        assert( int( _engines.size() ) < WidgetRegistry::MaxSlots );
+        engine->setIndex( _engines.size() );
+        _engines.push_back( engine );
+
+        // configure
+        configureEngine( engine );
+        if( !_enabled ) engine->setEnabled( false );
+
+        // comboboxes and groupbox labels need the size allocation hook
+        if( engine == _comboEngine || engine == _comboBoxEngine || engine == _comboBoxEntryEngine || engine == _groupBoxLabelEngine )
+        { initializeSizeAllocationHook(); }
+
+    }
+
+    //____________________________________________________________________________________________
+    void Animations::configureEngine( BaseEngine* engine )
+    {
+
+        // do nothing if settings are not set yet
+        if( !_settings ) return;
+        const QtSettings& settings( *_settings );
+
+        const bool animationsEnabled( settings.animationsEnabled() );
+
+        // pass animations configuration to engines
+        if( engine == _widgetStateEngine ) {
+
+            _widgetStateEngine->setApplicationName( settings.applicationName() );
+            _widgetStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
+            _widgetStateEngine->setDuration( settings.genericAnimationsDuration() );
+
+        } else if( engine == _arrowStateEngine ) {
+
+            _arrowStateEngine->setApplicationName( settings.applicationName() );
+            _arrowStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
+            _arrowStateEngine->setDuration( settings.genericAnimationsDuration() );
+
+        } else if( engine == _scrollBarStateEngine ) {
+
+            _scrollBarStateEngine->setApplicationName( settings.applicationName() );
+            _scrollBarStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
+            _scrollBarStateEngine->setDuration( settings.genericAnimationsDuration() );
+
+        } else if( engine == _tabWidgetStateEngine ) {
+
+            _tabWidgetStateEngine->setApplicationName( settings.applicationName() );
+            _tabWidgetStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
+            _tabWidgetStateEngine->setDuration( settings.genericAnimationsDuration() );
+
+        } else if( engine == _treeViewStateEngine ) {
+
+            _treeViewStateEngine->setApplicationName( settings.applicationName() );
+            _treeViewStateEngine->setEnabled( animationsEnabled && settings.genericAnimationsEnabled() );
+            _treeViewStateEngine->setDuration( settings.genericAnimationsDuration() );
+
+        } else if( engine == _menuBarStateEngine ) {
+
+            _menuBarStateEngine->setApplicationName( settings.applicationName() );
+            _menuBarStateEngine->setAnimationsEnabled( animationsEnabled && (settings.menuBarAnimationType() != NoAnimation) );
+            _menuBarStateEngine->setFollowMouse( settings.menuBarAnimationType() == FollowMouse );
+            _menuBarStateEngine->setDuration( settings.menuBarAnimationsDuration() );
+            _menuBarStateEngine->setFollowMouseAnimationsDuration( settings.menuBarFollowMouseAnimationsDuration() );
+
+        } else if( engine == _menuStateEngine ) {
+
+            _menuStateEngine->setApplicationName( settings.applicationName() );
+            _menuStateEngine->setEnabled( animationsEnabled && (settings.menuAnimationType() != NoAnimation) );
+            _menuStateEngine->setFollowMouse( settings.menuAnimationType() == FollowMouse );
+            _menuStateEngine->setDuration( settings.menuAnimationsDuration() );
+            _menuStateEngine->setFollowMouseAnimationsDuration( settings.menuFollowMouseAnimationsDuration() );
+
+        } else if( engine == _toolBarStateEngine ) {
+
+            // for now, only Fade animations mode is supported for toolbar animations
+            _toolBarStateEngine->setApplicationName( settings.applicationName() );
+            _toolBarStateEngine->setEnabled( animationsEnabled && (settings.toolBarAnimationType() != NoAnimation) );
+            _toolBarStateEngine->setFollowMouse(  settings.toolBarAnimationType() == FollowMouse );
+            _toolBarStateEngine->setDuration( settings.genericAnimationsDuration() );
+            _toolBarStateEngine->setFollowMouseAnimationsDuration( settings.toolBarAnimationsDuration() );
+
+        } else if( engine == _backgroundHintEngine ) {
+
+            // background hint engine
+            _backgroundHintEngine->setUseBackgroundGradient( settings.useBackgroundGradient() );
+
+        }
+
+    }
+
+    //____________________________________________________________________________________________
+    bool Animations::registerWidget( GtkWidget* widget, BaseEngine* engine )
+    {
+
+        if( !widget ) return false;
+        WidgetRegistry::Record& record( WidgetRegistry::get( widget ) );
+
+        // mark engine as registered
+        const guint32 mask( 1u << engine->index() );
+        if( record._engines & mask ) return false;
+
+        const bool registered( record._engines );
+        record._engines |= mask;
+
+        // add destroy notification, once per widget
+        if( !registered )
+        {
+
+            #if OXYGEN_DEBUG
+            std::cerr << "Oxygen::Animations::registerWidget - " << widget << " (" << (widget ? G_OBJECT_TYPE_NAME( widget ):"0x0") << ")" << std::endl;
+            #endif
+
+            WidgetRegistry::addDestroyNotify( widget, destroyNotifyEvent, this );
+
+        }
 
-        Signal destroyId;
-        destroyId.connect( G_OBJECT( widget ), "destroy", G_CALLBACK( destroyNotifyEvent ), this );
-        _allWidgets.insert( std::make_pair( widget, destroyId ) );
         return true;
 
     }
@@ -186,19 +271,24 @@ namespace Oxygen
         std::cerr << "Oxygen::Animations::unregisterWidget - " << widget << " (" << G_OBJECT_TYPE_NAME( widget ) << ")" << std::endl;
         #endif
 
-        // find in map
-        WidgetMap::iterator iter( _allWidgets.find( widget ) );
-        assert( iter != _allWidgets.end() );
+        // find record
+        WidgetRegistry::Record* record( WidgetRegistry::find( widget ) );
+        assert( record );
 
-        // disconnect signal
-        iter->second.disconnect();
+        // get registered engines and clear
+        guint32 engines( record->_engines );
+        record->_engines = 0;
 
-        // erase from map
-        _allWidgets.erase( widget );
+        // remove destroy notification. This might delete the record
+        WidgetRegistry::removeDestroyNotify( widget, destroyNotifyEvent, this );
 
-        // erase from all maps
-        for( BaseEngine::List::iterator iter = _engines.begin(); iter != _engines.end(); ++iter )
-        { (*iter)->unregisterWidget( widget ); }
+        // erase from registered engines only
+        for( int index = 0; engines; ++index, engines >>= 1 )
+        { if( engines&1 ) _engines[index]->unregisterWidget( widget ); }
+
+        // record is deleted when no engine uses it anymore
+        if( ( record = WidgetRegistry::find( widget ) ) )
+        { WidgetRegistry::release( *record ); }
 
     }
 
@@ -206,6 +296,8 @@ namespace Oxygen
     void Animations::setEnabled( bool value )
     {
 
+        _enabled = value;
+
         for( BaseEngine::List::iterator iter = _engines.begin(); iter != _engines.end(); ++iter )
         { (*iter)->setEnabled( value ); }
 
@@ -228,12 +320,16 @@ namespace Oxygen
         // check type
         if( !GTK_IS_WIDGET( widget ) ) return FALSE;
 
+        // only labels and windows are handled
+        const unsigned int flags( Gtk::TypeFlags::get( G_OBJECT_TYPE( widget ) ) );
+        if( !( flags & ( Gtk::TypeFlags::Label|Gtk::TypeFlags::Window ) ) ) return TRUE;
+
         // cast data
         Animations& animations( *static_cast<Animations*>(data) );
 
         // groupbox labels
         #if ENABLE_GROUPBOX_HACK
-        if( animations.groupBoxLabelEngine().contains( widget ) )
+        if( animations._groupBoxLabelEngine && animations._groupBoxLabelEngine->contains( widget ) )
         {
             animations.groupBoxLabelEngine().adjustSize( widget );
             return TRUE;
@@ -242,14 +338,16 @@ namespace Oxygen
 
         #if ENABLE_COMBOBOX_LIST_RESIZE
         // comboboxes
-        if( !GTK_IS_WINDOW( widget ) ) return TRUE;
+        if( !( flags & Gtk::TypeFlags::Window ) ) return TRUE;
 
         GtkWindow* window( GTK_WINDOW( widget ) );
         if( gtk_window_get_type_hint( window ) != GDK_WINDOW_TYPE_HINT_COMBO ) return TRUE;
 
-        GtkWidget* combobox = animations.comboBoxEngine().find( widget );
-        if( !combobox ) combobox = animations.comboBoxEntryEngine().find( widget );
-        if( !combobox ) combobox = animations.comboEngine().find( widget );
+        // only look in engines that have been created
+        GtkWidget* combobox( 0L );
+        if( animations._comboBoxEngine ) combobox = animations._comboBoxEngine->find( widget );
+        if( !combobox && animations._comboBoxEntryEngine ) combobox = animations._comboBoxEntryEngine->find( widget );
+        if( !combobox && animations._comboEngine ) combobox = animations._comboEngine->find( widget );
         if( !combobox ) return true;
 
         int w, h;
@@ -288,8 +386,7 @@ namespace Oxygen
         if( !animations.innerShadowsEnabled() ) return TRUE;
 
         // blacklist
-        if( Gtk::g_object_is_a( G_OBJECT( widget ), "SwtFixed" ) ) return TRUE;
-        if( Gtk::g_object_is_a( G_OBJECT( widget ), "GtkPizza" ) ) return TRUE;
+        if( Gtk::TypeFlags::test( widget, Gtk::TypeFlags::InnerShadowBlackList ) ) return TRUE;
 
         GtkWidget* parent(gtk_widget_get_parent(widget));
         if( !GTK_IS_SCROLLED_WINDOW( parent ) ) return TRUE;
@@ -330,11 +427,13 @@ namespace Oxygen
         // check type
         if( !GTK_IS_WIDGET( widget ) ) return FALSE;
 
-        if( GTK_IS_NOTEBOOK( widget ) )
+        // only notebooks and labels are handled
+        const unsigned int flags( Gtk::TypeFlags::get( G_OBJECT_TYPE( widget ) ) );
+        if( flags & Gtk::TypeFlags::Notebook )
         { gtk_notebook_set_show_border( GTK_NOTEBOOK(widget), FALSE ); }
 
         #if ENABLE_GROUPBOX_HACK
-        if( GTK_IS_LABEL( widget ) &&  GTK_IS_FRAME( gtk_widget_get_parent( widget ) ) )
+        if( ( flags & Gtk::TypeFlags::Label ) &&  GTK_IS_FRAME( gtk_widget_get_parent( widget ) ) )
         {
 
             GtkFrame *frame( GTK_FRAME( gtk_widget_get_parent( widget ) ) );
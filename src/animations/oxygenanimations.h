@@ -48,12 +48,13 @@
 #include "oxygentoolbarstateengine.h"
 #include "oxygentreeviewengine.h"
 #include "oxygentreeviewstateengine.h"
+#include "oxygenwidgetregistry.h"
 #include "oxygenwidgetsizeengine.h"
 #include "oxygenwidgetstateengine.h"
 
 #include <gtk/gtk.h>
+#include <cassert>
 #include <vector>
-#include <map>
 
 namespace Oxygen
 {
@@ -62,6 +63,10 @@ namespace Oxygen
     class QtSettings;
 
     //! keeps track of all animation engines
+    /*!
+    engines are created on first use, and configured using the settings
+    passed to the last call to initialize, if any
+    */
     class Animations
     {
 
@@ -79,8 +84,9 @@ namespace Oxygen
         //! initialize hooks
         void initializeHooks( void );
 
-        //! unregister widget
-        bool registerWidget( GtkWidget* );
+        //! register widget for a given engine
+        /*! returns false if widget was already registered to this engine */
+        bool registerWidget( GtkWidget*, BaseEngine* );
 
         //! unregister widget
         void unregisterWidget( GtkWidget* );
@@ -97,119 +103,132 @@ namespace Oxygen
         { return _innerShadowsEnabled; }
 
         //! combo engine
-        ComboEngine& comboEngine( void ) const
-        { return *_comboEngine; }
+        ComboEngine& comboEngine( void )
+        { return getEngine( _comboEngine ); }
 
         //! combobox engine
-        ComboBoxEngine& comboBoxEngine( void ) const
-        { return *_comboBoxEngine; }
+        ComboBoxEngine& comboBoxEngine( void )
+        { return getEngine( _comboBoxEngine ); }
 
         //! comboboxentry engine
-        ComboBoxEntryEngine& comboBoxEntryEngine( void ) const
-        { return *_comboBoxEntryEngine; }
+        ComboBoxEntryEngine& comboBoxEntryEngine( void )
+        { return getEngine( _comboBoxEntryEngine ); }
 
         //! dialog engine
-        DialogEngine& dialogEngine( void ) const
-        { return *_dialogEngine; }
+        DialogEngine& dialogEngine( void )
+        { return getEngine( _dialogEngine ); }
 
         //! flat widget
-        FlatWidgetEngine& flatWidgetEngine( void ) const
-        { return *_flatWidgetEngine; }
+        FlatWidgetEngine& flatWidgetEngine( void )
+        { return getEngine( _flatWidgetEngine ); }
 
         //! groupbox engine
-        GroupBoxEngine& groupBoxEngine( void ) const
-        { return *_groupBoxEngine; }
+        GroupBoxEngine& groupBoxEngine( void )
+        { return getEngine( _groupBoxEngine ); }
 
         //! background hint
-        BackgroundHintEngine& backgroundHintEngine( void ) const
-        { return *_backgroundHintEngine; }
+        BackgroundHintEngine& backgroundHintEngine( void )
+        { return getEngine( _backgroundHintEngine ); }
 
         //! main window engine
-        MainWindowEngine& mainWindowEngine( void ) const
-        { return *_mainWindowEngine; }
+        MainWindowEngine& mainWindowEngine( void )
+        { return getEngine( _mainWindowEngine ); }
 
         //! menu item engine
-        MenuItemEngine& menuItemEngine( void ) const
-        { return *_menuItemEngine; }
+        MenuItemEngine& menuItemEngine( void )
+        { return getEngine( _menuItemEngine ); }
 
         //! hover engine
-        HoverEngine& hoverEngine( void ) const
-        { return *_hoverEngine; }
+        HoverEngine& hoverEngine( void )
+        { return getEngine( _hoverEngine ); }
 
         //! paned (splitter) engine
-        PanedEngine& panedEngine( void ) const
-        { return *_panedEngine; }
+        PanedEngine& panedEngine( void )
+        { return getEngine( _panedEngine ); }
 
         //! scrollbar engine
-        ScrollBarEngine& scrollBarEngine( void ) const
-        { return *_scrollBarEngine; }
+        ScrollBarEngine& scrollBarEngine( void )
+        { return getEngine( _scrollBarEngine ); }
 
         //! scrolled window engine
-        ScrolledWindowEngine& scrolledWindowEngine( void ) const
-        { return *_scrolledWindowEngine; }
+        ScrolledWindowEngine& scrolledWindowEngine( void )
+        { return getEngine( _scrolledWindowEngine ); }
 
         //! inner shadow engine
-        InnerShadowEngine& innerShadowEngine( void ) const
-        { return *_innerShadowEngine; }
+        InnerShadowEngine& innerShadowEngine( void )
+        { return getEngine( _innerShadowEngine ); }
 
         //! tab widget engine
-        TabWidgetEngine& tabWidgetEngine( void ) const
-        { return *_tabWidgetEngine; }
+        TabWidgetEngine& tabWidgetEngine( void )
+        { return getEngine( _tabWidgetEngine ); }
 
         //! tree view engine
-        TreeViewEngine& treeViewEngine( void ) const
-        { return *_treeViewEngine; }
+        TreeViewEngine& treeViewEngine( void )
+        { return getEngine( _treeViewEngine ); }
 
         //! window size engine
-        WidgetSizeEngine& widgetSizeEngine( void ) const
-        { return *_widgetSizeEngine; }
+        WidgetSizeEngine& widgetSizeEngine( void )
+        { return getEngine( _widgetSizeEngine ); }
 
         //!@name animations specific engines
         //@{
 
         //! widget mouse-over and focus animations engine
-        WidgetStateEngine& widgetStateEngine( void ) const
-        { return *_widgetStateEngine; }
+        WidgetStateEngine& widgetStateEngine( void )
+        { return getEngine( _widgetStateEngine ); }
 
         //! arrow mouse-over animations engine
-        ArrowStateEngine& arrowStateEngine( void ) const
-        { return *_arrowStateEngine; }
+        ArrowStateEngine& arrowStateEngine( void )
+        { return getEngine( _arrowStateEngine ); }
 
         //! scrollbar arrow mouse-over animations engine
-        ScrollBarStateEngine& scrollBarStateEngine( void ) const
-        { return *_scrollBarStateEngine; }
+        ScrollBarStateEngine& scrollBarStateEngine( void )
+        { return getEngine( _scrollBarStateEngine ); }
 
         //! notebook tabs mouse-over animations engine
-        TabWidgetStateEngine& tabWidgetStateEngine( void ) const
-        { return *_tabWidgetStateEngine; }
+        TabWidgetStateEngine& tabWidgetStateEngine( void )
+        { return getEngine( _tabWidgetStateEngine ); }
 
         //! tree view mouse-over animation engine
-        TreeViewStateEngine& treeViewStateEngine( void ) const
-        { return *_treeViewStateEngine; }
+        TreeViewStateEngine& treeViewStateEngine( void )
+        { return getEngine( _treeViewStateEngine ); }
 
         //! menubar mouse-over animation engine
-        MenuBarStateEngine& menuBarStateEngine( void ) const
-        { return *_menuBarStateEngine; }
+        MenuBarStateEngine& menuBarStateEngine( void )
+        { return getEngine( _menuBarStateEngine ); }
 
         //! menu mouse-over animation engine
-        MenuStateEngine& menuStateEngine( void ) const
-        { return *_menuStateEngine; }
+        MenuStateEngine& menuStateEngine( void )
+        { return getEngine( _menuStateEngine ); }
 
         //! toolbar mouse-over animation engine
-        ToolBarStateEngine& toolBarStateEngine( void ) const
-        { return *_toolBarStateEngine; }
+        ToolBarStateEngine& toolBarStateEngine( void )
+        { return getEngine( _toolBarStateEngine ); }
 
         //@}
 
         protected:
 
+        //! return engine, create if needed
+        template<typename T>
+        T& getEngine( T*& pointer )
+        {
+            if( !pointer ) registerEngine( pointer = new T( this ) );
+            return *pointer;
+        }
+
         //! register new engine
-        void registerEngine( BaseEngine* engine )
-        { _engines.push_back( engine ); }
+        void registerEngine( BaseEngine* );
+
+        //! pass settings to engine
+        void configureEngine( BaseEngine* );
+
+        //! connect size allocation hook, if needed
+        void initializeSizeAllocationHook( void );
 
         //! groupbox engine
-        GroupBoxLabelEngine& groupBoxLabelEngine( void ) const
-        { return *_groupBoxLabelEngine; }
+        GroupBoxLabelEngine& groupBoxLabelEngine( void )
+        { return getEngine( _groupBoxLabelEngine ); }
 
         //! destruction callback
         static gboolean destroyNotifyEvent( GtkWidget*, gpointer );
@@ -225,6 +244,12 @@ namespace Oxygen
 
         private:
 
+        //! settings passed to last initialization
+        const QtSettings* _settings;
+
+        //! enabled state, for engines created after a call to setEnabled
+        bool _enabled;
+
         //! inner shadow enabled state
         bool _innerShadowsEnabled;
 
@@ -326,16 +351,14 @@ namespace Oxygen
         //! combobox hook
         Hook _sizeAllocationHook;
 
+        //! true when size allocation hook is connected
+        bool _sizeAllocationHookInitialized;
+
         //! inner shadows hook
         Hook _innerShadowHook;
 
-
         //@}
 
-        //! keep track of all registered widgets, and associated destroy callback
-        typedef std::map< GtkWidget*, Signal > WidgetMap;
-        WidgetMap _allWidgets;
-
     };
 
 }
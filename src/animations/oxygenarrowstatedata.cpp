@@ -19,6 +19,7 @@
 */
 
 #include "oxygenarrowstatedata.h"
+#include "oxygentimelineserver.h"
 #include "../config.h"
 
 #include <iostream>
@@ -86,7 +87,7 @@ namespace Oxygen
         ArrowStateData& data( *static_cast<ArrowStateData*>( pointer ) );
 
         if( data._target )
-        { gtk_widget_queue_draw( data._target ); }
+        { TimeLineServer::instance().queueDraw( data._target ); }
 
         return FALSE;
 
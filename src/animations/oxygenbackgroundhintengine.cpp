@@ -19,6 +19,7 @@
 */
 
 #include "oxygenbackgroundhintengine.h"
+#include "../oxygenx11atoms.h"
 #include "config.h"
 
 #include <iostream>
@@ -39,19 +40,8 @@ namespace Oxygen
 
         // create background gradient atom
         #ifdef GDK_WINDOWING_X11
-        GdkDisplay *display( gdk_display_get_default () );
-        if( display )
-        {
-
-            _backgroundGradientAtom = XInternAtom( GDK_DISPLAY_XDISPLAY( display ), "_KDE_OXYGEN_BACKGROUND_GRADIENT", False);
-            _backgroundPixmapAtom = XInternAtom( GDK_DISPLAY_XDISPLAY( display ), "_KDE_OXYGEN_BACKGROUND_PIXMAP", False);
-
-        } else {
-
-            _backgroundGradientAtom = None;
-            _backgroundPixmapAtom = None;
-
-        }
+        _backgroundGradientAtom = X11Atoms::instance().atom( X11Atoms::BackgroundGradient );
+        _backgroundPixmapAtom = X11Atoms::instance().atom( X11Atoms::BackgroundPixmap );
         #endif
     }
 
@@ -25,6 +25,6 @@ namespace Oxygen
 {
     //______________________________________________________
     bool BaseEngine::registerWidget( GtkWidget* widget )
-    { return parent().registerWidget( widget ); }
+    { return parent().registerWidget( widget, this ); }
 
 }
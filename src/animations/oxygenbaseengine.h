@@ -38,7 +38,8 @@ namespace Oxygen
         //! constructor
         BaseEngine( Animations* parent ):
             _parent( parent ),
-            _enabled( true )
+            _enabled( true ),
+            _index( 0 )
         {}
 
         virtual ~BaseEngine()
@@ -66,6 +67,14 @@ namespace Oxygen
         bool enabled( void ) const
         { return _enabled; }
 
+        //! index in parent engine list
+        int index( void ) const
+        { return _index; }
+
+        //! index in parent engine list
+        void setIndex( int value )
+        { _index = value; }
+
         protected:
 
         //! returns parent
@@ -80,6 +89,9 @@ namespace Oxygen
         //! enable flag
         bool _enabled;
 
+        //! index in parent engine list
+        int _index;
+
     };
 
 }
@@ -118,7 +118,7 @@ namespace Oxygen
             assert( !_cell._widget );
 
             _cell._widget = GTK_WIDGET( child->data );
-            _cell._destroyId.connect( G_OBJECT(widget), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+            _cell._destroyId.connect( widget, childDestroyNotifyEvent, this );
 
             updateCellViewColor();
 
@@ -209,7 +209,7 @@ namespace Oxygen
             // allocate new Hover data
             HoverData data;
             data._widget = widget;
-            data._destroyId.connect( G_OBJECT(widget), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+            data._destroyId.connect( widget, childDestroyNotifyEvent, this );
             data._enterId.connect( G_OBJECT(widget), "enter-notify-event", G_CALLBACK( enterNotifyEvent ), this );
             data._leaveId.connect( G_OBJECT(widget), "leave-notify-event", G_CALLBACK( leaveNotifyEvent ), this );
 
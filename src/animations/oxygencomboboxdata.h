@@ -20,6 +20,7 @@
 * MA 02110-1301, USA.
 */
 
+#include "oxygendestroynotifier.h"
 #include "oxygensignal.h"
 
 #include <gtk/gtk.h>
@@ -180,7 +181,7 @@ namespace Oxygen
             GtkWidget* _widget;
 
             //!callback id
-            Signal _destroyId;
+            DestroyNotifier _destroyId;
 
         };
 
@@ -20,6 +20,7 @@
 * MA 02110-1301, USA.
 */
 
+#include "oxygendestroynotifier.h"
 #include "oxygenhoverdata.h"
 #include "oxygensignal.h"
 
@@ -164,7 +165,7 @@ namespace Oxygen
 
             //!@name callback ids
             //@{
-            Signal _destroyId;
+            DestroyNotifier _destroyId;
             Signal _enterId;
             Signal _leaveId;
             Signal _toggledId;
@@ -55,6 +55,7 @@ namespace Oxygen
         {
             if( contains( widget ) ) return false;
             _data.insert( widget );
+            BaseEngine::registerWidget( widget );
             return true;
         }
 
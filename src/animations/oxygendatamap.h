@@ -20,22 +20,24 @@
 * MA 02110-1301, USA.
 */
 
+#include "oxygenwidgetregistry.h"
+
 #include <cassert>
-#include <map>
+#include <new>
+#include <vector>
 #include <gtk/gtk.h>
 
 namespace Oxygen
 {
 
     //! generic class to map data to widgets
-    /*
-    Note: I'm not sure about memory management. At some point one might need to allocate the registered
-    data on the heap rather than on the stack, to be able to safely pass the data pointer around via callbacks.
-    The current implementation should make that possible without external code change, provided that the map
-    content is properly deleted (as opposed to erased) in destructor and 'unregister' method.
+    /*!
+    data are stored in nodes allocated from a pool, by blocks, so that references to the data remain valid
+    until the widget is erased. Nodes are found from the widget using a dedicated slot in its WidgetRegistry record,
+    and chained together for iteration.
     */
     template <typename T>
-    class DataMap
+    class DataMap: public WidgetRegistry::Client
     {
 
         public:
@@ -43,18 +45,35 @@ namespace Oxygen
         //! constructor
         DataMap( void ):
             _lastWidget( 0L ),
-            _lastData( 0L )
+            _lastData( 0L ),
+            _slot( WidgetRegistry::registerClient( this ) ),
+            _freeNodes( 0L )
         {}
 
-        virtual ~DataMap(){}
+        //! destructor
+        virtual ~DataMap()
+        {
+            clear();
+            WidgetRegistry::unregisterClient( _slot );
+            for( BlockList::iterator iter = _blocks.begin(); iter != _blocks.end(); ++iter )
+            { ::operator delete( *iter ); }
+        }
 
         //! insert new widget
         inline T& registerWidget( GtkWidget* widget )
         {
-            T& data( _map.insert( std::make_pair( widget, T() ) ).first->second );
+            WidgetRegistry::Record& record( WidgetRegistry::get( widget ) );
+            Node* node( static_cast<Node*>( record.slot( _slot ) ) );
+            if( !node )
+            {
+                node = allocate( widget );
+                record.setSlot( _slot, node );
+                _map.append( node );
+            }
+
             _lastWidget = widget;
-            _lastData = &data;
-            return data;
+            _lastData = &node->second;
+            return node->second;
         }
 
         //! true if widget is in list
@@ -64,13 +83,13 @@ namespace Oxygen
             // check against last widget
             if( widget == _lastWidget ) return true;
 
-            // find in map, returns false if not found
-            typename Map::iterator iter = _map.find( widget );
-            if( iter == _map.end() ) return false;
+            // find in registry, returns false if not found
+            Node* node( find( widget ) );
+            if( !node ) return false;
 
             // store as last widget/last data, to speed up lookup.
             _lastWidget = widget;
-            _lastData = &iter->second;
+            _lastData = &node->second;
             return true;
 
         }
@@ -82,14 +101,14 @@ namespace Oxygen
             // check against last widget
             if( widget == _lastWidget ) return *_lastData;
 
-            // find in map, abort if not found
-            typename Map::iterator iter(  _map.find( widget ) );
-            assert( iter != _map.end() );
+            // find in registry, abort if not found
+            Node* node( find( widget ) );
+            assert( node );
 
             // store as last widget/last data, to speed up lookup.
             _lastWidget = widget;
-            _lastData = &iter->second;
-            return iter->second;
+            _lastData = &node->second;
+            return node->second;
 
         }
 
@@ -104,8 +123,16 @@ namespace Oxygen
                 _lastData = 0L;
             }
 
-            // erase from map
-            _map.erase( widget );
+            // erase from registry and list
+            WidgetRegistry::Record* record( WidgetRegistry::find( widget ) );
+            if( !( record && record->slot( _slot ) ) ) return;
+
+            Node* node( static_cast<Node*>( record->slot( _slot ) ) );
+            record->setSlot( _slot, 0L );
+            WidgetRegistry::release( *record );
+
+            _map.remove( node );
+            release( node );
 
         }
 
@@ -130,12 +157,186 @@ namespace Oxygen
 
             _lastWidget = 0L;
             _lastData = 0L;
-            _map.clear();
+
+            while( Node* node = _map.first() )
+            {
+                if( WidgetRegistry::Record* record = WidgetRegistry::find( node->first ) )
+                {
+                    record->setSlot( _slot, 0L );
+                    WidgetRegistry::release( *record );
+                }
+
+                _map.remove( node );
+                release( node );
+            }
 
         }
 
+        //! stores widget and associated data
+        /*! member names match std::pair, for iterating over the map */
+        class Node
+        {
+
+            public:
+
+            //! constructor
+            explicit Node( GtkWidget* widget ):
+                first( widget ),
+                second(),
+                _previous( 0L ),
+                _next( 0L )
+            {}
+
+            //! widget
+            GtkWidget* first;
+
+            //! data
+            T second;
+
+            //! previous node in map
+            Node* _previous;
+
+            //! next node in map
+            Node* _next;
+
+        };
+
+        //! chained list of nodes, for iteration
+        class Map
+        {
+
+            public:
+
+            //! constructor
+            Map( void ):
+                _first( 0L ),
+                _last( 0L ),
+                _size( 0 )
+            {}
+
+            //! iterator
+            template <typename N>
+            class Iterator
+            {
+
+                public:
+
+                //! constructor
+                Iterator( N* node = 0L ):
+                    _node( node )
+                {}
+
+                //!@name accessors
+                //@{
+                N& operator * ( void ) const
+                { return *_node; }
+
+                N* operator -> ( void ) const
+                { return _node; }
+                //@}
+
+                //!@name increment
+                //@{
+                Iterator& operator ++ ( void )
+                {
+                    _node = _node->_next;
+                    return *this;
+                }
+
+                Iterator operator ++ ( int )
+                {
+                    Iterator out( *this );
+                    _node = _node->_next;
+                    return out;
+                }
+                //@}
+
+                //! equal to operator
+                bool operator == ( const Iterator& other ) const
+                { return _node == other._node; }
+
+                //! different from operator
+                bool operator != ( const Iterator& other ) const
+                { return _node != other._node; }
+
+                private:
+
+                //! current node
+                N* _node;
+
+            };
+
+            typedef Iterator<Node> iterator;
+            typedef Iterator<const Node> const_iterator;
+
+            //!@name iterators
+            //@{
+            iterator begin( void )
+            { return iterator( _first ); }
+
+            iterator end( void )
+            { return iterator(); }
+
+            const_iterator begin( void ) const
+            { return const_iterator( _first ); }
+
+            const_iterator end( void ) const
+            { return const_iterator(); }
+            //@}
+
+            //! size
+            size_t size( void ) const
+            { return _size; }
+
+            //! true if empty
+            bool empty( void ) const
+            { return _size == 0; }
+
+            protected:
+
+            //! first node
+            Node* first( void ) const
+            { return _first; }
+
+            //! append node
+            void append( Node* node )
+            {
+                node->_previous = _last;
+                node->_next = 0L;
+                if( _last ) _last->_next = node;
+                else _first = node;
+                _last = node;
+                ++_size;
+            }
+
+            //! remove node
+            void remove( Node* node )
+            {
+                if( node->_previous ) node->_previous->_next = node->_next;
+                else _first = node->_next;
+
+                if( node->_next ) node->_next->_previous = node->_previous;
+                else _last = node->_previous;
+
+                --_size;
+            }
+
+            private:
+
+            //! first node
+            Node* _first;
+
+            //! last node
+            Node* _last;
+
+            //! number of nodes
+            size_t _size;
+
+            friend class DataMap<T>;
+
+        };
+
         //! retrieve internal map
-        typedef std::map<GtkWidget*, T> Map;
         Map& map( void )
         { return _map; }
 
@@ -146,7 +347,12 @@ namespace Oxygen
         protected:
 
         //! copy constructor is private
-        DataMap( const DataMap& )
+        DataMap( const DataMap& ):
+            WidgetRegistry::Client(),
+            _lastWidget( 0L ),
+            _lastData( 0L ),
+            _slot( WidgetRegistry::registerClient( this ) ),
+            _freeNodes( 0L )
         { assert( false ); }
 
         //! assignment operator
@@ -156,17 +362,85 @@ namespace Oxygen
             return *this;
         }
 
+        //! find node matching widget
+        Node* find( GtkWidget* widget ) const
+        {
+            WidgetRegistry::Record* record( WidgetRegistry::find( widget ) );
+            return record ? static_cast<Node*>( record->slot( _slot ) ) : 0L;
+        }
+
+        //! widget is finalized while still in map. Remove node, without accessing the widget
+        virtual void finalizeSlot( GtkWidget* widget, void* data )
+        {
+
+            if( _lastWidget == widget )
+            {
+                _lastWidget = 0L;
+                _lastData = 0L;
+            }
+
+            Node* node( static_cast<Node*>( data ) );
+            _map.remove( node );
+            release( node );
+
+        }
+
+        //! create node from pool
+        Node* allocate( GtkWidget* widget )
+        {
+            if( !_freeNodes ) grow();
+            void* slot( _freeNodes );
+            _freeNodes = *static_cast<void**>( slot );
+            return new( slot ) Node( widget );
+        }
+
+        //! destroy node and give it back to pool
+        /*! freed slots are chained using their first bytes, which is safe since Node contains pointers */
+        void release( Node* node )
+        {
+            node->~Node();
+            void* slot( node );
+            *static_cast<void**>( slot ) = _freeNodes;
+            _freeNodes = slot;
+        }
+
+        //! allocate a new block of nodes and add its slots to the free list
+        void grow( void )
+        {
+            char* block( static_cast<char*>( ::operator new( BlockSize*sizeof( Node ) ) ) );
+            _blocks.push_back( block );
+            for( int i = BlockSize - 1; i >= 0; --i )
+            {
+                void* slot( block + i*sizeof( Node ) );
+                *static_cast<void**>( slot ) = _freeNodes;
+                _freeNodes = slot;
+            }
+        }
+
         private:
 
+        //! number of nodes allocated at once
+        enum { BlockSize = 32 };
+
         //! pointer to last inquired widget
         GtkWidget* _lastWidget;
 
         //! pointer to last retrieved data
         T* _lastData;
 
-        //! internal map between widget and data
+        //! slot index in widget registry records
+        int _slot;
+
+        //! nodes, for iteration
         Map _map;
 
+        //! allocated blocks
+        typedef std::vector<void*> BlockList;
+        BlockList _blocks;
+
+        //! first free slot
+        void* _freeNodes;
+
     };
 
 }
@@ -0,0 +1,90 @@
+#ifndef oxygendestroynotifier_h
+#define oxygendestroynotifier_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenwidgetregistry.h"
+
+#include <gtk/gtk.h>
+
+namespace Oxygen
+{
+
+    //! handles widget destruction notification
+    /*!
+    replaces a "destroy" signal connection. The callback is stored in the widget registry record,
+    which uses a single weak reference per widget, whatever the number of callbacks.
+    Like Signal, it can be copied, and must be disconnected explicitly.
+    */
+    class DestroyNotifier
+    {
+
+        public:
+
+        //! constructor
+        DestroyNotifier( void ):
+            _widget( 0L ),
+            _callback( 0L ),
+            _data( 0L )
+        {}
+
+        //! destructor
+        virtual ~DestroyNotifier( void )
+        {}
+
+        //! true if connected
+        bool isConnected( void ) const
+        { return _widget != 0L; }
+
+        //! connect
+        void connect( GtkWidget* widget, WidgetRegistry::DestroyCallback callback, gpointer data )
+        {
+            if( !widget ) return;
+            _widget = widget;
+            _callback = callback;
+            _data = data;
+            WidgetRegistry::addDestroyNotify( widget, callback, data );
+        }
+
+        //! disconnect
+        void disconnect( void )
+        {
+            if( _widget ) WidgetRegistry::removeDestroyNotify( _widget, _callback, _data );
+            _widget = 0L;
+            _callback = 0L;
+            _data = 0L;
+        }
+
+        private:
+
+        //! widget
+        GtkWidget* _widget;
+
+        //! callback
+        WidgetRegistry::DestroyCallback _callback;
+
+        //! data
+        gpointer _data;
+
+    };
+
+}
+
+#endif
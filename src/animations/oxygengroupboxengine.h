@@ -47,7 +47,11 @@ namespace Oxygen
 
         //! register widget
         virtual bool registerWidget( GtkWidget* widget )
-        { return( _data.insert( widget ).second ); }
+        {
+            if( !_data.insert( widget ).second ) return false;
+            BaseEngine::registerWidget( widget );
+            return true;
+        }
 
         //! unregister widget
         virtual void unregisterWidget( GtkWidget* widget )
@@ -28,6 +28,7 @@
 */
 
 #include "oxygenmenubarstatedata.h"
+#include "oxygentimelineserver.h"
 #include "../oxygengtkutils.h"
 #include "../config.h"
 
@@ -109,8 +110,8 @@ namespace Oxygen
                 << std::endl;
             #endif
 
-            Signal destroyId;
-            destroyId.connect( G_OBJECT( widget ), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+            DestroyNotifier destroyId;
+            destroyId.connect( widget, childDestroyNotifyEvent, this );
             _children.insert( std::make_pair( widget, destroyId ) );
         }
 
@@ -350,7 +351,7 @@ namespace Oxygen
         if( data._target )
         {
             const GdkRectangle rect( data.dirtyRect() );
-            Gtk::gtk_widget_queue_draw( data._target, &rect );
+            TimeLineServer::instance().queueDraw( data._target, &rect );
         }
 
         return FALSE;
@@ -366,7 +367,7 @@ namespace Oxygen
         {
             data.updateAnimatedRect();
             GdkRectangle rect( data.dirtyRect() );
-            Gtk::gtk_widget_queue_draw( data._target, &rect );
+            TimeLineServer::instance().queueDraw( data._target, &rect );
         }
 
         return FALSE;
@@ -30,6 +30,7 @@
 #include "../oxygenanimationdata.h"
 #include "../oxygenanimationmodes.h"
 #include "../oxygengtkutils.h"
+#include "oxygendestroynotifier.h"
 #include "oxygenfollowmousedata.h"
 #include "oxygensignal.h"
 #include "oxygentimeline.h"
@@ -259,7 +260,7 @@ namespace Oxygen
         //@}
 
         //! map children to destroy signal
-        typedef std::map<GtkWidget*, Signal> ChildrenMap;
+        typedef std::map<GtkWidget*, DestroyNotifier> ChildrenMap;
         ChildrenMap _children;
 
     };
@@ -19,6 +19,7 @@
 */
 
 #include "oxygenmenustatedata.h"
+#include "oxygentimelineserver.h"
 #include "../oxygengtkutils.h"
 #include "../config.h"
 
@@ -119,8 +120,8 @@ namespace Oxygen
                 << std::endl;
             #endif
 
-            Signal destroyId;
-            destroyId.connect( G_OBJECT( widget ), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+            DestroyNotifier destroyId;
+            destroyId.connect( widget, childDestroyNotifyEvent, this );
             _children.insert( std::make_pair( widget, destroyId ) );
         }
 
@@ -425,7 +426,7 @@ namespace Oxygen
         if( data._target )
         {
             const GdkRectangle rect( data.dirtyRect() );
-            Gtk::gtk_widget_queue_draw( data._target, &rect );
+            TimeLineServer::instance().queueDraw( data._target, &rect );
         }
 
         return FALSE;
@@ -443,7 +444,7 @@ namespace Oxygen
 
             data.updateAnimatedRect();
             const GdkRectangle rect( data.dirtyRect() );
-            Gtk::gtk_widget_queue_draw( data._target, &rect );
+            TimeLineServer::instance().queueDraw( data._target, &rect );
 
         }
 
@@ -23,6 +23,7 @@
 #include "../oxygenanimationdata.h"
 #include "../oxygenanimationmodes.h"
 #include "../oxygengtkutils.h"
+#include "oxygendestroynotifier.h"
 #include "oxygenfollowmousedata.h"
 #include "oxygensignal.h"
 #include "oxygentimer.h"
@@ -296,7 +297,7 @@ namespace Oxygen
         //@}
 
         //! map children to destroy signal
-        typedef std::map<GtkWidget*, Signal> ChildrenMap;
+        typedef std::map<GtkWidget*, DestroyNotifier> ChildrenMap;
         ChildrenMap _children;
 
     };
@@ -0,0 +1,126 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenredrawaggregator.h"
+#include "../oxygengtkutils.h"
+
+namespace Oxygen
+{
+
+    //____________________________________________________________________
+    RedrawAggregator::~RedrawAggregator( void )
+    {
+        for( EntryList::iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        { if( iter->_region ) gdk_region_destroy( iter->_region ); }
+    }
+
+    //____________________________________________________________________
+    void RedrawAggregator::queueDraw( GtkWidget* widget, const GdkRectangle* rect )
+    {
+
+        if( !widget ) return;
+
+        // pass to gtk directly when not collecting
+        if( !_enabled )
+        {
+            Gtk::gtk_widget_queue_draw( widget, rect );
+            return;
+        }
+
+        // find matching entry
+        Entry* entry( 0L );
+        for( EntryList::iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        {
+            if( iter->_widget != widget ) continue;
+            entry = &(*iter);
+            break;
+        }
+
+        if( !entry )
+        {
+            _entries.push_back( Entry( widget ) );
+            entry = &_entries.back();
+        }
+
+        // full widget is already dirty
+        if( entry->_full ) return;
+
+        if( !Gtk::gdk_rectangle_is_valid( rect ) )
+        {
+
+            entry->_full = true;
+            if( entry->_region )
+            {
+                gdk_region_destroy( entry->_region );
+                entry->_region = 0L;
+            }
+
+        } else if( !entry->_region ) entry->_region = gdk_region_rectangle( rect );
+        else gdk_region_union_with_rect( entry->_region, rect );
+
+    }
+
+    //____________________________________________________________________
+    void RedrawAggregator::flush( void )
+    {
+
+        _enabled = false;
+
+        for( EntryList::iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        {
+
+            // full widget
+            if( iter->_full )
+            {
+                Gtk::gtk_widget_queue_draw( iter->_widget );
+                continue;
+            }
+
+            if( !iter->_region ) continue;
+
+            // dirty rectangles
+            GdkRectangle* rectangles( 0L );
+            gint count( 0 );
+            gdk_region_get_rectangles( iter->_region, &rectangles, &count );
+            if( count > MaxRectangles )
+            {
+
+                // use bounding rect when there are too many rectangles
+                GdkRectangle rect;
+                gdk_region_get_clipbox( iter->_region, &rect );
+                Gtk::gtk_widget_queue_draw( iter->_widget, &rect );
+
+            } else {
+
+                for( gint i = 0; i < count; ++i )
+                { Gtk::gtk_widget_queue_draw( iter->_widget, &rectangles[i] ); }
+
+            }
+
+            g_free( rectangles );
+            gdk_region_destroy( iter->_region );
+
+        }
+
+        _entries.clear();
+
+    }
+
+}
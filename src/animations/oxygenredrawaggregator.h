@@ -0,0 +1,98 @@
+#ifndef oxygenredrawaggregator_h
+#define oxygenredrawaggregator_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include <gtk/gtk.h>
+#include <vector>
+
+namespace Oxygen
+{
+
+    //! collects redraw requests issued by animations during one TimeLineServer tick
+    /*!
+    dirty rectangles are merged per target widget, and a single set of invalidations
+    is sent per widget when the tick ends. Outside of a tick, requests are passed to gtk directly
+    */
+    class RedrawAggregator
+    {
+
+        public:
+
+        //! constructor
+        RedrawAggregator( void ):
+            _enabled( false )
+        {}
+
+        //! destructor
+        virtual ~RedrawAggregator( void );
+
+        //! start collecting redraw requests
+        void begin( void )
+        { _enabled = true; }
+
+        //! send collected redraw requests, and stop collecting
+        void flush( void );
+
+        //! queue redraw of given widget rect
+        /*! if rect is invalid, the full widget is redrawn */
+        void queueDraw( GtkWidget*, const GdkRectangle* = 0L );
+
+        private:
+
+        //! max number of rectangles sent per widget. A bounding rect is used above
+        enum { MaxRectangles = 4 };
+
+        //! dirty area of a given widget
+        class Entry
+        {
+
+            public:
+
+            //! constructor
+            explicit Entry( GtkWidget* widget ):
+                _widget( widget ),
+                _region( 0L ),
+                _full( false )
+            {}
+
+            //! widget
+            GtkWidget* _widget;
+
+            //! dirty region
+            GdkRegion* _region;
+
+            //! true if full widget must be redrawn
+            bool _full;
+
+        };
+
+        //! true when collecting
+        bool _enabled;
+
+        //! dirty areas
+        typedef std::vector<Entry> EntryList;
+        EntryList _entries;
+
+    };
+
+}
+
+#endif
@@ -19,6 +19,7 @@
 */
 
 #include "oxygenscrollbarstatedata.h"
+#include "oxygentimelineserver.h"
 #include "../config.h"
 
 #include <iostream>
@@ -88,7 +89,7 @@ namespace Oxygen
         ScrollBarStateData& data( *static_cast<ScrollBarStateData*>( pointer ) );
 
         if( data._target )
-        { gtk_widget_queue_draw( data._target ); }
+        { TimeLineServer::instance().queueDraw( data._target ); }
 
         return FALSE;
 
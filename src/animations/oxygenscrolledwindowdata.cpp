@@ -68,8 +68,8 @@ namespace Oxygen
         } else {
 
             // list widget types for which scrolled window needs register
-            static const char* widgetTypes[] = { "ExoIconView", "FMIconContainer", 0L };
-            for( unsigned int i = 0; widgetTypes[i]; i++ )
+            static const Gtk::TypeName widgetTypes[] = { Gtk::TypeName( "ExoIconView" ), Gtk::TypeName( "FMIconContainer" ), Gtk::TypeName( 0L ) };
+            for( unsigned int i = 0; widgetTypes[i].name(); i++ )
             {
                 if( Gtk::g_object_is_a( G_OBJECT( child ), widgetTypes[i] ) )
                 {
@@ -139,7 +139,7 @@ namespace Oxygen
 
             // allocate new Hover data
             ChildData data;
-            data._destroyId.connect( G_OBJECT(widget), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+            data._destroyId.connect( widget, childDestroyNotifyEvent, this );
             data._enterId.connect( G_OBJECT(widget), "enter-notify-event", G_CALLBACK( enterNotifyEvent ), this );
             data._leaveId.connect( G_OBJECT(widget), "leave-notify-event", G_CALLBACK( leaveNotifyEvent ), this );
             data._focusInId.connect( G_OBJECT(widget), "focus-in-event", G_CALLBACK( focusInNotifyEvent ), this );
@@ -21,6 +21,7 @@
 * MA 02110-1301, USA.
 */
 
+#include "oxygendestroynotifier.h"
 #include "oxygensignal.h"
 
 #include <gtk/gtk.h>
@@ -111,7 +112,7 @@ namespace Oxygen
             bool _hovered;
             bool _focused;
 
-            Signal _destroyId;
+            DestroyNotifier _destroyId;
             Signal _enterId;
             Signal _leaveId;
             Signal _focusInId;
@@ -79,7 +79,9 @@ namespace Oxygen
             std::cerr << "Oxygen::Signal::disconnect - _id: " << _id << " counter: " << counter << std::endl;
             #endif
 
-            g_signal_handler_disconnect( _object, _id );
+            // handler might already be gone if object is being disposed
+            if( g_signal_handler_is_connected( _object, _id ) )
+            { g_signal_handler_disconnect( _object, _id ); }
 
         }
 
@@ -25,7 +25,9 @@
 #include "../config.h"
 
 #include <gtk/gtk.h>
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <iostream>
 
 namespace Oxygen
@@ -43,7 +45,11 @@ namespace Oxygen
         _motionId.connect( G_OBJECT(widget), "motion-notify-event", G_CALLBACK( motionNotifyEvent ), this );
         _leaveId.connect( G_OBJECT(widget), "leave-notify-event", G_CALLBACK( leaveNotifyEvent ), this );
         _pageAddedId.connect( G_OBJECT(widget), "page-added", G_CALLBACK( pageAddedEvent ), this );
+        _pageRemovedId.connect( G_OBJECT(widget), "page-removed", G_CALLBACK( pageChangedEvent ), this );
+        _pageReorderedId.connect( G_OBJECT(widget), "page-reordered", G_CALLBACK( pageChangedEvent ), this );
+        _sizeAllocateId.connect( G_OBJECT(widget), "size-allocate", G_CALLBACK( sizeAllocateEvent ), this );
 
+        invalidateGeometry();
         updateRegisteredChildren( widget );
 
     }
@@ -60,6 +66,15 @@ namespace Oxygen
         _motionId.disconnect();
         _leaveId.disconnect();
         _pageAddedId.disconnect();
+        _pageRemovedId.disconnect();
+        _pageReorderedId.disconnect();
+        _sizeAllocateId.disconnect();
+
+        // clear geometry
+        invalidateGeometry();
+        _tabPositions.clear();
+        _labelPositions.clear();
+        _firstTab = 0L;
 
         // disconnect all children
         for( ChildDataMap::iterator iter = _childrenData.begin(); iter != _childrenData.end(); ++iter )
@@ -79,15 +94,8 @@ namespace Oxygen
         int xPointer,yPointer;
         gdk_window_get_pointer( gtk_widget_get_window( widget ), &xPointer, &yPointer, 0L );
 
-        // loop over tabs and check matching
-        for( unsigned int i = (unsigned int)Gtk::gtk_notebook_find_first_tab( widget ); i < _tabRects.size(); i++ )
-        {
-            if( Gtk::gdk_rectangle_contains( &_tabRects[i], xPointer, yPointer ) )
-            { setHoveredTab( widget, i ); return; }
-        }
-
-        // reset hovered tab
-        setHoveredTab( widget, -1 );
+        // find matching tab
+        setHoveredTab( widget, tabAt( xPointer, yPointer ) );
         return;
 
     }
@@ -98,14 +106,22 @@ namespace Oxygen
         // make sure the vector has the right size
         if( !GTK_IS_NOTEBOOK( widget ) ) return;
         GtkNotebook* notebook = GTK_NOTEBOOK( widget );
-        _tabRects.resize( gtk_notebook_get_n_pages( notebook ), defaultRect() );
+        const size_t count( gtk_notebook_get_n_pages( notebook ) );
+        if( _tabRects.size() != count )
+        {
+            _tabRects.resize( count, defaultRect() );
+            _tabPositionsValid = false;
+        }
 
         // check index against number of tabs
         if( index < 0 || index >= (int)_tabRects.size() )
         { return; }
 
         // store rectangle
-        _tabRects[index]=r;
+        GdkRectangle& rect( _tabRects[index] );
+        if( rect.x == r.x && rect.y == r.y && rect.width == r.width && rect.height == r.height ) return;
+        rect = r;
+        _tabPositionsValid = false;
     }
 
     //________________________________________________________________________________
@@ -117,8 +133,7 @@ namespace Oxygen
         {
 
             // we should only update the tabbar rect here
-            GdkRectangle updateRect;
-            Gtk::gtk_notebook_get_tabbar_rect( GTK_NOTEBOOK( _target ), &updateRect );
+            const GdkRectangle& updateRect( tabbarRect() );
             Gtk::gtk_widget_queue_draw( _target, &updateRect );
 
             #if OXYGEN_DEBUG
@@ -130,14 +145,164 @@ namespace Oxygen
     }
 
     //________________________________________________________________________________
-    bool TabWidgetData::isInTab( int x, int y ) const
+    int TabWidgetData::findTab( int x, int y )
     {
 
-        // loop over tab rectangles and check.
-        for( RectangleList::const_iterator iter = _tabRects.begin(); iter != _tabRects.end(); ++iter )
-        { if( Gtk::gdk_rectangle_contains( &(*iter), x, y ) ) return true; }
+        updateLabelPositions();
+        if( _labelPositions.empty() ) return -1;
+
+        // find first label whose center is after position
+        const int position( _vertical ? y:x );
+        const TabPositionList::const_iterator first( std::lower_bound( _labelPositions.begin(), _labelPositions.end(), TabPosition( -1, position ) ) );
 
-        return false;
+        /*
+        look for the label with smallest manhattan distance to position, on both sides.
+        The search stops as soon as the distance along the tabbar direction alone is larger than the best match
+        */
+        int tab( -1 );
+        int minDistance( -1 );
+        for( TabPositionList::const_iterator iter = first; iter != _labelPositions.end(); ++iter )
+        {
+            if( minDistance >= 0 && iter->_position - position > minDistance ) break;
+            const int distance(
+                std::abs( iter->_rect.x + iter->_rect.width/2 - x ) +
+                std::abs( iter->_rect.y + iter->_rect.height/2 - y ) );
+
+            if( minDistance < 0 || distance < minDistance || ( distance == minDistance && iter->_index < tab ) )
+            {
+                tab = iter->_index;
+                minDistance = distance;
+            }
+        }
+
+        for( TabPositionList::const_iterator iter = first; iter != _labelPositions.begin(); )
+        {
+            --iter;
+            if( minDistance >= 0 && position - iter->_position > minDistance ) break;
+            const int distance(
+                std::abs( iter->_rect.x + iter->_rect.width/2 - x ) +
+                std::abs( iter->_rect.y + iter->_rect.height/2 - y ) );
+
+            if( minDistance < 0 || distance < minDistance || ( distance == minDistance && iter->_index < tab ) )
+            {
+                tab = iter->_index;
+                minDistance = distance;
+            }
+        }
+
+        return tab;
+
+    }
+
+    //________________________________________________________________________________
+    int TabWidgetData::tabAt( int x, int y )
+    {
+
+        updateTabPositions();
+
+        // find last tab starting before position
+        const int position( _vertical ? y:x );
+        TabPositionList::const_iterator iter( std::upper_bound( _tabPositions.begin(), _tabPositions.end(), TabPosition( -1, position ) ) );
+
+        // also check the previous one, since the current tab overlaps with its neighbors
+        for( int i = 0; i < 2 && iter != _tabPositions.begin(); ++i )
+        {
+            --iter;
+            if( Gtk::gdk_rectangle_contains( &iter->_rect, x, y ) ) return iter->_index;
+        }
+
+        return -1;
+
+    }
+
+    //________________________________________________________________________________
+    bool TabWidgetData::firstTabChanged( void ) const
+    { return GTK_IS_NOTEBOOK( _target ) && GTK_NOTEBOOK( _target )->first_tab != _firstTab; }
+
+    //________________________________________________________________________________
+    void TabWidgetData::updateTabPositions( void )
+    {
+
+        if( _tabPositionsValid && !firstTabChanged() ) return;
+        if( !GTK_IS_NOTEBOOK( _target ) ) return;
+
+        GtkNotebook* notebook( GTK_NOTEBOOK( _target ) );
+        if( _firstTab != notebook->first_tab )
+        {
+            // first visible tab changed. Label positions must also be updated
+            _firstTab = notebook->first_tab;
+            _labelPositionsValid = false;
+        }
+
+        const GtkPositionType position( gtk_notebook_get_tab_pos( notebook ) );
+        _vertical = ( position == GTK_POS_LEFT || position == GTK_POS_RIGHT );
+
+        // store valid rectangles, starting from first visible tab
+        _tabPositions.clear();
+        for( int i = Gtk::gtk_notebook_find_first_tab( _target ); i < (int)_tabRects.size(); ++i )
+        {
+            const GdkRectangle& rect( _tabRects[i] );
+            if( !Gtk::gdk_rectangle_is_valid( &rect ) ) continue;
+            _tabPositions.push_back( TabPosition( i, _vertical ? rect.y:rect.x, rect ) );
+        }
+
+        std::sort( _tabPositions.begin(), _tabPositions.end() );
+        _tabPositionsValid = true;
+
+    }
+
+    //________________________________________________________________________________
+    void TabWidgetData::updateLabelPositions( void )
+    {
+
+        if( _labelPositionsValid && !firstTabChanged() ) return;
+        if( !GTK_IS_NOTEBOOK( _target ) ) return;
+
+        GtkNotebook* notebook( GTK_NOTEBOOK( _target ) );
+        if( _firstTab != notebook->first_tab )
+        {
+            // first visible tab changed. Tab positions must also be updated
+            _firstTab = notebook->first_tab;
+            _tabPositionsValid = false;
+        }
+
+        const GtkPositionType position( gtk_notebook_get_tab_pos( notebook ) );
+        _vertical = ( position == GTK_POS_LEFT || position == GTK_POS_RIGHT );
+
+        // store tab label allocations, starting from first visible tab
+        _labelPositions.clear();
+        for( int i = Gtk::gtk_notebook_find_first_tab( _target ); i < gtk_notebook_get_n_pages( notebook ); ++i )
+        {
+
+            // retrieve page and tab label
+            GtkWidget* page( gtk_notebook_get_nth_page( notebook, i ) );
+            if( !page ) continue;
+
+            GtkWidget* tabLabel( gtk_notebook_get_tab_label( notebook, page ) );
+            if( !tabLabel ) continue;
+
+            const GtkAllocation allocation( Gtk::gtk_widget_get_allocation( tabLabel ) );
+            const int center( _vertical ? allocation.y + allocation.height/2 : allocation.x + allocation.width/2 );
+            _labelPositions.push_back( TabPosition( i, center, allocation ) );
+
+        }
+
+        std::sort( _labelPositions.begin(), _labelPositions.end() );
+        _labelPositionsValid = true;
+
+    }
+
+    //________________________________________________________________________________
+    const GdkRectangle& TabWidgetData::tabbarRect( void )
+    {
+
+        if( !_tabbarRectValid && GTK_IS_NOTEBOOK( _target ) )
+        {
+            Gtk::gtk_notebook_get_tabbar_rect( GTK_NOTEBOOK( _target ), &_tabbarRect );
+            _tabbarRectValid = true;
+        }
+
+        return _tabbarRect;
 
     }
 
@@ -147,12 +312,18 @@ namespace Oxygen
 
         if( _hoveredTab == index ) return;
 
+        const int oldIndex( _hoveredTab );
         _hoveredTab = index;
 
+        // only update previously and newly hovered tabs
         GdkRectangle updateRect( Gtk::gdk_rectangle() );
-        for( RectangleList::const_iterator iter = _tabRects.begin(); iter != _tabRects.end(); ++iter )
-        { gdk_rectangle_union( &(*iter), &updateRect, &updateRect ); }
+        if( oldIndex >= 0 && oldIndex < (int)_tabRects.size() )
+        { Gtk::gdk_rectangle_union( &_tabRects[oldIndex], &updateRect, &updateRect ); }
 
+        if( index >= 0 && index < (int)_tabRects.size() )
+        { Gtk::gdk_rectangle_union( &_tabRects[index], &updateRect, &updateRect ); }
+
+        if( !Gtk::gdk_rectangle_is_valid( &updateRect ) ) return;
         gtk_widget_queue_draw_area( widget, updateRect.x-4, updateRect.y-4, updateRect.width+8, updateRect.height+8 );
 
         return;
@@ -181,9 +352,18 @@ namespace Oxygen
         #if OXYGEN_DEBUG
         std::cerr << "Oxygen::TabWidgetData::pageAddedEvent - " << child << std::endl;
         #endif
+        static_cast<TabWidgetData*>(data)->invalidateGeometry();
         static_cast<TabWidgetData*>(data)->updateRegisteredChildren( GTK_WIDGET( parent ) );
     }
 
+    //________________________________________________________________________________
+    void TabWidgetData::pageChangedEvent( GtkNotebook*, GtkWidget*, guint, gpointer data )
+    { static_cast<TabWidgetData*>(data)->invalidateGeometry(); }
+
+    //________________________________________________________________________________
+    void TabWidgetData::sizeAllocateEvent( GtkWidget*, GtkAllocation*, gpointer data )
+    { static_cast<TabWidgetData*>(data)->invalidateGeometry(); }
+
     //________________________________________________________________________________
     void TabWidgetData::updateRegisteredChildren( GtkWidget* widget )
     {
@@ -222,9 +402,10 @@ namespace Oxygen
 
             // allocate new ChildData
             ChildData data;
-            data._destroyId.connect( G_OBJECT(widget), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+            data._destroyId.connect( widget, childDestroyNotifyEvent, this );
             data._enterId.connect( G_OBJECT(widget), "enter-notify-event", G_CALLBACK( childCrossingNotifyEvent ), this );
             data._leaveId.connect( G_OBJECT(widget), "leave-notify-event", G_CALLBACK( childCrossingNotifyEvent ), this );
+            data._sizeAllocateId.connect( G_OBJECT(widget), "size-allocate", G_CALLBACK( sizeAllocateEvent ), this );
 
             if( GTK_IS_CONTAINER( widget ) )
             { data._addId.connect( G_OBJECT(widget), "add", G_CALLBACK( childAddedEvent ), this ); }
@@ -299,6 +480,7 @@ namespace Oxygen
         _enterId.disconnect();
         _leaveId.disconnect();
         _addId.disconnect();
+        _sizeAllocateId.disconnect();
 
     }
 
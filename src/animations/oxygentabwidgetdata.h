@@ -20,6 +20,8 @@
 * MA 02110-1301, USA.
 */
 
+#include "../oxygengtkutils.h"
+#include "oxygendestroynotifier.h"
 #include "oxygensignal.h"
 
 #include <gtk/gtk.h>
@@ -40,7 +42,13 @@ namespace Oxygen
             _target(0L),
             _hoveredTab(-1),
             _dragInProgress( false ),
-            _dirty( false )
+            _dirty( false ),
+            _vertical( false ),
+            _firstTab( 0L ),
+            _tabPositionsValid( false ),
+            _labelPositionsValid( false ),
+            _tabbarRectValid( false ),
+            _tabbarRect( Gtk::gdk_rectangle() )
         {}
 
         //! destructor
@@ -63,6 +71,14 @@ namespace Oxygen
         //! update hovered tab
         void updateHoveredTab( GtkWidget* = 0L );
 
+        //! invalidate stored tab geometry
+        void invalidateGeometry( void )
+        {
+            _tabPositionsValid = false;
+            _labelPositionsValid = false;
+            _tabbarRectValid = false;
+        }
+
         //! true when drag is in progress
         void setDragInProgress( bool value )
         { _dragInProgress = value; }
@@ -92,7 +108,12 @@ namespace Oxygen
         { return _dirty; }
 
         //! returns true if provided point is in one tab of the widget
-        bool isInTab( int x, int y ) const;
+        bool isInTab( int x, int y )
+        { return tabAt( x, y ) >= 0; }
+
+        //! returns index of tab whose label is closest to given position
+        /*! this is used at paint time, to find which tab is being rendered */
+        int findTab( int x, int y );
 
         //@]
 
@@ -101,6 +122,26 @@ namespace Oxygen
         //! set current tab
         void setHoveredTab( GtkWidget*, int );
 
+        //! returns index of tab that contains given position, or -1
+        int tabAt( int x, int y );
+
+        //!@name tab geometry
+        //@{
+
+        //! true if first visible tab has changed since geometry was stored
+        bool firstTabChanged( void ) const;
+
+        //! update sorted tab rectangles
+        void updateTabPositions( void );
+
+        //! update sorted tab label positions
+        void updateLabelPositions( void );
+
+        //! tabbar rect
+        const GdkRectangle& tabbarRect( void );
+
+        //@}
+
         //! child registration
         //@{
 
@@ -115,6 +156,8 @@ namespace Oxygen
         static gboolean motionNotifyEvent( GtkWidget*, GdkEventMotion*, gpointer );
         static gboolean leaveNotifyEvent( GtkWidget*, GdkEventCrossing*, gpointer );
         static void pageAddedEvent( GtkNotebook*, GtkWidget*, guint, gpointer );
+        static void pageChangedEvent( GtkNotebook*, GtkWidget*, guint, gpointer );
+        static void sizeAllocateEvent( GtkWidget*, GtkAllocation*, gpointer );
         static gboolean childDestroyNotifyEvent( GtkWidget*, gpointer );
         static gboolean childCrossingNotifyEvent( GtkWidget*, GdkEventCrossing*, gpointer );
         static void childAddedEvent( GtkContainer*, GtkWidget*, gpointer );
@@ -137,6 +180,9 @@ namespace Oxygen
         Signal _motionId;
         Signal _leaveId;
         Signal _pageAddedId;
+        Signal _pageRemovedId;
+        Signal _pageReorderedId;
+        Signal _sizeAllocateId;
         //@}
 
         //! index of currently hovered tab
@@ -155,6 +201,57 @@ namespace Oxygen
         typedef std::vector<GdkRectangle> RectangleList;
         RectangleList _tabRects;
 
+        //! tab geometry, sorted along the tabbar direction, for binary search
+        class TabPosition
+        {
+            public:
+
+            //! constructor
+            explicit TabPosition( int index = -1, int position = 0, const GdkRectangle& rect = Gtk::gdk_rectangle() ):
+                _index( index ),
+                _position( position ),
+                _rect( rect )
+            {}
+
+            //! less than operator
+            bool operator < ( const TabPosition& other ) const
+            { return _position < other._position; }
+
+            //! tab index
+            int _index;
+
+            //! position along the tabbar direction
+            int _position;
+
+            //! rectangle
+            GdkRectangle _rect;
+
+        };
+
+        typedef std::vector<TabPosition> TabPositionList;
+
+        //! tab rectangles, sorted by starting position
+        TabPositionList _tabPositions;
+
+        //! tab label allocations, sorted by center position
+        TabPositionList _labelPositions;
+
+        //! true if tabs are on the left or right side
+        bool _vertical;
+
+        //! first visible tab, when geometry was stored
+        GList* _firstTab;
+
+        //!@name geometry validity
+        //@{
+        bool _tabPositionsValid;
+        bool _labelPositionsValid;
+        bool _tabbarRectValid;
+        //@}
+
+        //! tabbar rect
+        GdkRectangle _tabbarRect;
+
         //! child data
         /*!
         one must keep track of the tab widgets children enter/leave event
@@ -176,10 +273,11 @@ namespace Oxygen
             //! disconnect all signals
             void disconnect( void );
 
-            Signal _destroyId;
+            DestroyNotifier _destroyId;
             Signal _addId;
             Signal _enterId;
             Signal _leaveId;
+            Signal _sizeAllocateId;
         };
 
         //! map registered children and corresponding data
@@ -94,6 +94,10 @@ namespace Oxygen
         bool isInTab( GtkWidget* widget, int x, int y )
         { return data().value( widget ).isInTab( x, y ); }
 
+        //! returns index of tab whose label is closest to provided point
+        int findTab( GtkWidget* widget, int x, int y )
+        { return data().value( widget ).findTab( x, y ); }
+
         //! true when drag is in progress
         bool dragInProgress( GtkWidget* widget )
         { return data().value( widget ).dragInProgress(); }
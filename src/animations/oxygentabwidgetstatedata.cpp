@@ -19,6 +19,7 @@
 */
 
 #include "oxygentabwidgetstatedata.h"
+#include "oxygentimelineserver.h"
 #include "../oxygengtkutils.h"
 #include "../config.h"
 
@@ -147,7 +148,7 @@ namespace Oxygen
         if( !data._target ) return FALSE;
 
         const GdkRectangle rect( data.dirtyRect() );
-        Gtk::gtk_widget_queue_draw( data._target, &rect );
+        TimeLineServer::instance().queueDraw( data._target, &rect );
         return FALSE;
 
     }
@@ -37,10 +37,10 @@ namespace Oxygen
         _running( false ),
         _value( 0 ),
         _time( 0 ),
-        _timer( g_timer_new() ),
+        _startTime( 0 ),
         _func( 0L ),
         _data( 0L )
-    { TimeLineServer::instance().registerTimeLine( this ); }
+    {}
 
     //_________________________________________________
     TimeLine::TimeLine( const TimeLine& other ):
@@ -50,16 +50,15 @@ namespace Oxygen
         _running( false ),
         _value( 0 ),
         _time( 0 ),
-        _timer( g_timer_new() ),
+        _startTime( 0 ),
         _func( other._func ),
         _data( other._data )
-    { TimeLineServer::instance().registerTimeLine( this ); }
+    {}
 
     //_________________________________________________
     TimeLine::~TimeLine( void )
     {
-        if( _timer ) g_timer_destroy( _timer );
-        TimeLineServer::instance().unregisterTimeLine( this );
+        if( _running ) TimeLineServer::instance().unregisterTimeLine( this );
     }
 
     //_________________________________________________
@@ -91,9 +90,10 @@ namespace Oxygen
 
         _value = (_direction == Forward ) ? 0:1;
         _time = 0;
-        g_timer_start( _timer );
+        _startTime = g_get_monotonic_time();
         _running = true;
 
+        TimeLineServer::instance().registerTimeLine( this );
         TimeLineServer::instance().start();
         trigger();
 
@@ -105,20 +105,22 @@ namespace Oxygen
 
         if( !_running ) return;
 
-        g_timer_stop( _timer );
         _running = false;
+
+        TimeLineServer::instance().unregisterTimeLine( this );
     }
 
     //_________________________________________________
-    bool TimeLine::update( void )
+    bool TimeLine::update( gint64 time )
     {
 
         if( !_running ) return false;
 
         // get time (msec)
-        const int elapsed( int(1000*g_timer_elapsed(_timer, 0L)) );
+        // timeline might have been started after the current tick time was sampled
+        const gint64 elapsedTime( time > _startTime ? (time - _startTime)/1000:0 );
         const double end( _direction == Forward ? 1:0 );
-        if( elapsed >= _duration )
+        if( elapsedTime >= _duration )
         {
 
             _time = _duration;
@@ -129,6 +131,7 @@ namespace Oxygen
 
         } else {
 
+            const int elapsed( elapsedTime );
 
             // for debugging only
             assert( _time < _duration );
@@ -108,10 +108,11 @@ namespace Oxygen
 
         //! update value and running state
         /*!
+        time is the current tick time, in microseconds, as returned by g_get_monotonic_time.
         also emits signal when value has changed since last time.
         returns true if timeline is still running
         */
-        bool update( void );
+        bool update( gint64 time );
 
         //@}
 
@@ -153,8 +154,8 @@ namespace Oxygen
         //! time (at which _value was last calculated)
         int _time;
 
-        //! timer
-        GTimer* _timer;
+        //! start time (microseconds)
+        gint64 _startTime;
 
         //! source function
         GSourceFunc _func;
@@ -23,13 +23,17 @@
 #include "../config.h"
 
 #include <gdk/gdk.h>
+#include <algorithm>
 #include <iostream>
 
 namespace Oxygen
 {
 
-    //! time interval between two updates (use 20 msec for now)
-    static const int updateInterval = 20;
+    //! default time interval between two updates (msec)
+    static const int defaultInterval = 20;
+
+    //! maximum interval between two updates, relative to target interval
+    static const int maxIntervalRatio = 5;
 
     //____________________________________________________________________
     TimeLineServer* TimeLineServer::_instance = 0L;
@@ -44,7 +48,11 @@ namespace Oxygen
 
     //____________________________________________________________________
     TimeLineServer::TimeLineServer( void ):
-        _timerId( 0 )
+        _timerId( 0 ),
+        _targetInterval( defaultInterval ),
+        _interval( defaultInterval ),
+        _lastTime( 0 ),
+        _frameTime( 0 )
     {
         #if OXYGEN_DEBUG
         std::cerr << "TimeLineServer::TimeLineServer." << std::endl;
@@ -65,17 +73,48 @@ namespace Oxygen
 
     }
 
+    //____________________________________________________________________
+    void TimeLineServer::unregisterTimeLine( TimeLine* timeLine )
+    {
+
+        _timeLines.erase( timeLine );
+
+        // make sure timeline is not updated anymore if a tick is in progress
+        if( !_updatedTimeLines.empty() )
+        { std::replace( _updatedTimeLines.begin(), _updatedTimeLines.end(), timeLine, static_cast<TimeLine*>( 0L ) ); }
+
+    }
+
     //____________________________________________________________________
     void TimeLineServer::start( void )
     {
 
         if( !_timerId )
-        { _timerId =  gdk_threads_add_timeout( updateInterval, (GSourceFunc)update, this ); }
+        {
+
+            // reset frame rate monitoring
+            _interval = _targetInterval;
+            _lastTime = 0;
+            _frameTime = 0;
+
+            _timerId =  gdk_threads_add_timeout( _interval, (GSourceFunc)update, this );
+
+        }
 
         return;
 
     }
 
+    //____________________________________________________________________
+    void TimeLineServer::setTargetFrameRate( int value )
+    {
+        _targetInterval = value > 0 ? std::max( 1, 1000/value ):defaultInterval;
+
+        #if OXYGEN_DEBUG
+        std::cerr << "TimeLineServer::setTargetFrameRate - interval: " << _targetInterval << std::endl;
+        #endif
+    }
+
     //____________________________________________________________________
     void TimeLineServer::stop( void )
     {
@@ -92,18 +131,81 @@ namespace Oxygen
     gboolean TimeLineServer::update( gpointer data )
     {
 
-        bool running( false );
         TimeLineServer& server( *static_cast<TimeLineServer*>( data ) );
 
-        // loop over timelines
-        for( TimeLineSet::const_iterator iter = server._timeLines.begin(); iter != server._timeLines.end(); ++iter )
-        { if( (*iter)->update() ) running = true; }
+        // sample time once for all timelines
+        const gint64 time( g_get_monotonic_time() );
+
+        // adjust interval
+        const int interval( server._interval );
+        const bool finish( server.updateInterval( time ) );
+
+        // loop over running timelines
+        server._redraws.begin();
+        server._updatedTimeLines.assign( server._timeLines.begin(), server._timeLines.end() );
+        for( TimeLineList::const_iterator iter = server._updatedTimeLines.begin(); iter != server._updatedTimeLines.end(); ++iter )
+        { if( *iter ) (*iter)->update( finish ? G_MAXINT64:time ); }
+
+        server._updatedTimeLines.clear();
+
+        // send redraws
+        server._redraws.flush();
 
-        // stop timeout
-        if( !running ) server.stop();
+        // stop timeout if no timeline is running
+        if( server._timeLines.empty() )
+        {
+            server.stop();
+            return FALSE;
+        }
+
+        // restart timeout if interval has changed
+        if( server._interval != interval )
+        {
+            server._timerId = gdk_threads_add_timeout( server._interval, (GSourceFunc)update, &server );
+            return FALSE;
+        }
+
+        return TRUE;
+
+    }
+
+    //____________________________________________________________________
+    bool TimeLineServer::updateInterval( gint64 time )
+    {
+
+        const gint64 lastTime( _lastTime );
+        _lastTime = time;
+        if( !lastTime ) return false;
+
+        // average time between updates
+        const gint64 frameTime( time - lastTime );
+        _frameTime = _frameTime ? ( 3*_frameTime + frameTime )/4 : frameTime;
+
+        const int maxInterval( maxIntervalRatio*_targetInterval );
+        if( _frameTime > 2000*maxInterval )
+        {
+
+            #if OXYGEN_DEBUG
+            std::cerr << "TimeLineServer::updateInterval - finishing animations. frame time: " << _frameTime/1000 << std::endl;
+            #endif
+
+            _frameTime = 0;
+            _lastTime = 0;
+            return true;
+
+        } else if( _frameTime > 1500*_interval ) {
+
+            // updates are late. Increase interval
+            _interval = std::min( 2*_interval, maxInterval );
+
+        } else if( _frameTime < 1200*_interval && _interval > _targetInterval ) {
+
+            // updates are on time. Decrease interval
+            _interval = std::max( _interval - _targetInterval, _targetInterval );
+
+        }
 
-        // return true if at least one timeline is still running
-        return gboolean( running );
+        return false;
 
     }
 
@@ -21,8 +21,12 @@
 * MA 02110-1301, USA.
 */
 
-#include <glib.h>
+#include "oxygenredrawaggregator.h"
+
+#include <gtk/gtk.h>
 #include <set>
+#include <vector>
+
 namespace Oxygen
 {
 
@@ -30,7 +34,16 @@ namespace Oxygen
     //! forward declaration
     class TimeLine;
 
-    //! keep track of timelines, triggers update at regular intervals, as long as running
+    //! keep track of running timelines, triggers update at regular intervals, as long as at least one is running
+    /*!
+    timelines register themselves when started and unregister when stopped,
+    so that the cost of an update only depends on the number of running animations.
+
+    The time elapsed between two updates, which includes the repaints they trigger, is monitored.
+    When it exceeds the update interval, the interval is increased, up to a maximum, so that less
+    intermediate frames are painted. If it still exceeds twice the maximum interval, running
+    animations are brought to their end state at once.
+    */
     class TimeLineServer
     {
 
@@ -42,17 +55,28 @@ namespace Oxygen
         //! destructor
         virtual ~TimeLineServer( void );
 
-        //! register timeline
+        //! register running timeline
         void registerTimeLine( TimeLine* timeLine )
         { _timeLines.insert( timeLine ); }
 
-        //! unregister timeline
-        void unregisterTimeLine( TimeLine* timeLine )
-        { _timeLines.erase( timeLine ); }
+        //! unregister timeline, when stopped or destroyed
+        void unregisterTimeLine( TimeLine* );
 
         //! start timeout if needed
         void start( void );
 
+        //! target frame rate (frames per second)
+        void setTargetFrameRate( int );
+
+        //! current interval between two updates (msec)
+        int interval( void ) const
+        { return _interval; }
+
+        //! queue widget redraw
+        /*! when called during an update, redraws are merged and sent at the end of the update */
+        void queueDraw( GtkWidget* widget, const GdkRectangle* rect = 0L )
+        { _redraws.queueDraw( widget, rect ); }
+
         protected:
 
         //! stop timeout
@@ -61,23 +85,47 @@ namespace Oxygen
         //! update registered timers
         static gboolean update( gpointer );
 
+        //! adjust update interval, based on time elapsed since last update
+        /*! returns true if running animations must be finished at once */
+        bool updateInterval( gint64 );
+
         private:
 
         //! constructor is private
         TimeLineServer( void );
 
-        //! keeps track of all registered timelines
+        //! keeps track of running timelines
         typedef std::set< TimeLine* > TimeLineSet;
         TimeLineSet _timeLines;
 
+        //! timelines updated during current tick
+        /*!
+        running timelines are copied here since they can be stopped while iterating.
+        Timelines unregistered during the tick are reset to null, since they might have been deleted
+        */
+        typedef std::vector< TimeLine* > TimeLineList;
+        TimeLineList _updatedTimeLines;
+
+        //! collects redraws issued by timelines during update
+        RedrawAggregator _redraws;
+
         //! timer id
         int _timerId;
 
-        //! singleton
-        static TimeLineServer* _instance;
+        //! target interval between two updates (msec)
+        int _targetInterval;
 
+        //! current interval between two updates (msec)
+        int _interval;
 
+        //! time of last update (microseconds)
+        gint64 _lastTime;
 
+        //! averaged time between two updates (microseconds)
+        gint64 _frameTime;
+
+        //! singleton
+        static TimeLineServer* _instance;
 
     };
 
@@ -19,6 +19,7 @@
 */
 
 #include "oxygentoolbarstatedata.h"
+#include "oxygentimelineserver.h"
 #include "../oxygengtkutils.h"
 #include "../config.h"
 
@@ -106,7 +107,7 @@ namespace Oxygen
 
             // allocate new Hover data
             HoverData data;
-            data._destroyId.connect( G_OBJECT(widget), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+            data._destroyId.connect( widget, childDestroyNotifyEvent, this );
             data._enterId.connect( G_OBJECT(widget), "enter-notify-event", G_CALLBACK( childEnterNotifyEvent ), this );
             data._leaveId.connect( G_OBJECT(widget), "leave-notify-event", G_CALLBACK( childLeaveNotifyEvent ), this );
 
@@ -339,9 +340,9 @@ namespace Oxygen
         if( data._target )
         {
             const GdkRectangle rect( data.dirtyRect() );
-            Gtk::gtk_widget_queue_draw( data._target, &rect );
-            if( data._previous._widget ) Gtk::gtk_widget_queue_draw( data._previous._widget );
-            if( data._current._widget ) Gtk::gtk_widget_queue_draw( data._current._widget );
+            TimeLineServer::instance().queueDraw( data._target, &rect );
+            if( data._previous._widget ) TimeLineServer::instance().queueDraw( data._previous._widget );
+            if( data._current._widget ) TimeLineServer::instance().queueDraw( data._current._widget );
         }
 
         return FALSE;
@@ -360,9 +361,9 @@ namespace Oxygen
             data.updateAnimatedRect();
 
             GdkRectangle rect( data.dirtyRect() );
-            Gtk::gtk_widget_queue_draw( data._target, &rect );
-            if( data._previous._widget ) Gtk::gtk_widget_queue_draw( data._previous._widget );
-            if( data._current._widget ) Gtk::gtk_widget_queue_draw( data._current._widget );
+            TimeLineServer::instance().queueDraw( data._target, &rect );
+            if( data._previous._widget ) TimeLineServer::instance().queueDraw( data._previous._widget );
+            if( data._current._widget ) TimeLineServer::instance().queueDraw( data._current._widget );
 
         }
 
@@ -23,6 +23,7 @@
 #include "../oxygenanimationdata.h"
 #include "../oxygenanimationmodes.h"
 #include "../oxygengtkutils.h"
+#include "oxygendestroynotifier.h"
 #include "oxygenfollowmousedata.h"
 #include "oxygensignal.h"
 #include "oxygentimeline.h"
@@ -276,7 +277,7 @@ namespace Oxygen
 
             //!@name callback ids
             //@{
-            Signal _destroyId;
+            DestroyNotifier _destroyId;
             Signal _enterId;
             Signal _leaveId;
             //@}
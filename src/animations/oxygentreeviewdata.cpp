@@ -21,6 +21,7 @@
 */
 
 #include "oxygentreeviewdata.h"
+#include "oxygentimelineserver.h"
 #include "../config.h"
 #include "../oxygengtkutils.h"
 
@@ -86,6 +87,10 @@ namespace Oxygen
         _columnsChangedId.disconnect();
         _motionId.disconnect();
 
+        // reset timer
+        _timer.stop();
+        _locked = false;
+
         // also free path if valid
         _cellInfo.clear();
 
@@ -126,7 +131,8 @@ namespace Oxygen
     void TreeViewData::updateHoveredCell( void )
     {
         if( !( isDirty() && GTK_IS_TREE_VIEW( _target ) ) ) return;
-        _cellInfo = Gtk::CellInfo( GTK_TREE_VIEW( _target ), _x, _y );
+        Gtk::CellInfo cellInfo( GTK_TREE_VIEW( _target ), _x, _y );
+        _cellInfo.swap( cellInfo );
         setDirty( false );
     }
 
@@ -134,7 +140,14 @@ namespace Oxygen
     bool TreeViewData::setHovered( GtkWidget* widget, bool value )
     {
         if( !HoverData::setHovered( widget, value ) ) return false;
-        if( !value ) clearPosition();
+        if( !value )
+        {
+            // discard pending position update
+            _timer.stop();
+            _locked = false;
+            clearPosition();
+        }
+
         return true;
     }
 
@@ -179,7 +192,7 @@ namespace Oxygen
         Gtk::gdk_rectangle_union( &oldRect, &newRect, &updateRect );
 
         // store new cell info
-        _cellInfo = cellInfo;
+        _cellInfo.swap( cellInfo );
 
         // convert to widget coordinates and schedule redraw
         gtk_tree_view_convert_bin_window_to_widget_coords( treeView, updateRect.x, updateRect.y, &updateRect.x, &updateRect.y );
@@ -251,7 +264,7 @@ namespace Oxygen
 
         // make sure widget is not already in map
         data._widget = widget;
-        data._destroyId.connect( G_OBJECT(widget), "destroy", G_CALLBACK( childDestroyNotifyEvent ), this );
+        data._destroyId.connect( widget, childDestroyNotifyEvent, this );
         data._valueChangedId.connect( G_OBJECT(widget), "value-changed", G_CALLBACK( childValueChanged ), this );
 
     }
@@ -297,12 +310,49 @@ namespace Oxygen
         if( !( event && event->window ) ) return FALSE;
 
         // make sure event window is treeview's bin window
-        if( GTK_IS_TREE_VIEW( widget ) && gtk_tree_view_get_bin_window( GTK_TREE_VIEW( widget ) ) == event->window )
-        { static_cast<TreeViewData*>( data )->updatePosition( widget, (int)event->x, (int)event->y ); }
+        if( !( GTK_IS_TREE_VIEW( widget ) && gtk_tree_view_get_bin_window( GTK_TREE_VIEW( widget ) ) == event->window ) )
+        { return FALSE; }
+
+        TreeViewData& treeViewData( *static_cast<TreeViewData*>( data ) );
+        if( treeViewData._timer.isRunning() )
+        {
+
+            // a hit-test was already performed during this frame. Store position and wait for timeout
+            treeViewData._x = (int)event->x;
+            treeViewData._y = (int)event->y;
+            treeViewData._locked = true;
+
+        } else {
+
+            // update immediately, and ignore further hit-tests until next frame
+            treeViewData.updatePosition( widget, (int)event->x, (int)event->y );
+            treeViewData._timer.start( TimeLineServer::instance().interval(), (GSourceFunc)delayedUpdatePosition, &treeViewData );
+
+        }
 
         return FALSE;
     }
 
+    //________________________________________________________________________________
+    gboolean TreeViewData::delayedUpdatePosition( gpointer pointer )
+    {
+
+        TreeViewData& data( *static_cast<TreeViewData*>( pointer ) );
+
+        // if pointer has not moved since last hit-test, stop timer
+        if( !( data._locked && data._target ) )
+        {
+            data._locked = false;
+            return FALSE;
+        }
+
+        // otherwise update using last position, and keep timer running
+        data._locked = false;
+        data.updatePosition( data._target );
+        return TRUE;
+
+    }
+
     //____________________________________________________________________________________________
     void TreeViewData::ScrollBarData::disconnect( void )
     {
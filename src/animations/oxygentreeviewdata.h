@@ -22,8 +22,10 @@
 */
 #include "../oxygengtkcellinfo.h"
 #include "../oxygengtkutils.h"
+#include "oxygendestroynotifier.h"
 #include "oxygenhoverdata.h"
 #include "oxygensignal.h"
+#include "oxygentimer.h"
 
 #include <gtk/gtk.h>
 #include <algorithm>
@@ -42,7 +44,8 @@ namespace Oxygen
             _fullWidth( false ),
             _x(-1),
             _y(-1),
-            _dirty( false )
+            _dirty( false ),
+            _locked( false )
         {}
 
         //! destructor
@@ -130,7 +133,7 @@ namespace Oxygen
             void disconnect( void );
 
             GtkWidget* _widget;
-            Signal _destroyId;
+            DestroyNotifier _destroyId;
             Signal _valueChangedId;
         };
 
@@ -147,6 +150,7 @@ namespace Oxygen
         static void childValueChanged( GtkRange*, gpointer );
         static void columnsChanged( GtkTreeView*, gpointer );
         static gboolean motionNotifyEvent( GtkWidget*, GdkEventMotion*, gpointer );
+        static gboolean delayedUpdatePosition( gpointer );
         //@}
 
         private:
@@ -180,6 +184,12 @@ namespace Oxygen
         //! true when hovered cell needs to be updated
         bool _dirty;
 
+        //! motion events are throttled to one hit-test per animation frame
+        Timer _timer;
+
+        //! true if pointer was moved since last hit-test
+        bool _locked;
+
         //! vertical scrollbar data
         ScrollBarData _vScrollBar;
 
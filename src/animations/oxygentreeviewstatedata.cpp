@@ -19,6 +19,7 @@
 */
 
 #include "oxygentreeviewstatedata.h"
+#include "oxygentimelineserver.h"
 #include "../config.h"
 
 #include <iostream>
@@ -174,7 +175,7 @@ namespace Oxygen
         if( data._target )
         {
             const GdkRectangle rect( data.dirtyRect() );
-            Gtk::gtk_widget_queue_draw( data._target, &rect );
+            TimeLineServer::instance().queueDraw( data._target, &rect );
         }
 
         return FALSE;
@@ -0,0 +1,206 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenwidgetregistry.h"
+#include "../config.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+namespace Oxygen
+{
+
+    //____________________________________________________________________
+    GQuark WidgetRegistry::_quark = 0;
+    WidgetRegistry::Client* WidgetRegistry::_clients[WidgetRegistry::MaxSlots] = { 0L };
+    WidgetRegistry::Record* WidgetRegistry::_first = 0L;
+
+    //____________________________________________________________________
+    int WidgetRegistry::registerClient( Client* client )
+    {
+
+        for( int i = 0; i < MaxSlots; ++i )
+        {
+            if( _clients[i] ) continue;
+            _clients[i] = client;
+            return i;
+        }
+
+        // all slots are used
+        assert( false );
+        return -1;
+
+    }
+
+    //____________________________________________________________________
+    void WidgetRegistry::unregisterClient( int index )
+    { if( index >= 0 && index < MaxSlots ) _clients[index] = 0L; }
+
+    //____________________________________________________________________
+    WidgetRegistry::Record& WidgetRegistry::get( GtkWidget* widget )
+    {
+
+        assert( widget );
+        if( Record* record = find( widget ) ) return *record;
+
+        // create record and attach to widget
+        Record* record( new Record( widget ) );
+        g_object_set_qdata_full( G_OBJECT( widget ), quark(), record, destroyNotify );
+
+        // insert in list
+        record->_next = _first;
+        if( _first ) _first->_previous = record;
+        _first = record;
+
+        return *record;
+
+    }
+
+    //____________________________________________________________________
+    void WidgetRegistry::release( Record& record )
+    {
+
+        if( !record.isEmpty() ) return;
+
+        // detach from widget, without triggering destroy notification
+        g_object_steal_qdata( G_OBJECT( record._widget ), quark() );
+        unlink( record );
+        delete &record;
+
+    }
+
+    //____________________________________________________________________
+    void WidgetRegistry::addDestroyNotify( GtkWidget* widget, DestroyCallback callback, gpointer data )
+    {
+
+        // do nothing if widget is already being disposed
+        Record& record( get( widget ) );
+        if( record._disposed ) return;
+
+        const Record::Listener listener( callback, data );
+        if( std::find( record._listeners.begin(), record._listeners.end(), listener ) != record._listeners.end() ) return;
+        record._listeners.push_back( listener );
+
+        // set weak reference, once per widget
+        if( !record._weakRef )
+        {
+            g_object_weak_ref( G_OBJECT( widget ), weakNotify, &record );
+            record._weakRef = true;
+        }
+
+    }
+
+    //____________________________________________________________________
+    void WidgetRegistry::removeDestroyNotify( GtkWidget* widget, DestroyCallback callback, gpointer data )
+    {
+
+        Record* record( find( widget ) );
+        if( !record ) return;
+
+        Record::ListenerList::iterator iter( std::find( record->_listeners.begin(), record->_listeners.end(), Record::Listener( callback, data ) ) );
+        if( iter == record->_listeners.end() ) return;
+        record->_listeners.erase( iter );
+
+        // remove weak reference when there is no listener left
+        if( record->_listeners.empty() && record->_weakRef )
+        {
+            g_object_weak_unref( G_OBJECT( widget ), weakNotify, record );
+            record->_weakRef = false;
+        }
+
+        release( *record );
+
+    }
+
+    //____________________________________________________________________
+    GQuark WidgetRegistry::quark( void )
+    {
+        if( !_quark ) _quark = g_quark_from_static_string( "oxygen-widget-registry" );
+        return _quark;
+    }
+
+    //____________________________________________________________________
+    void WidgetRegistry::destroyNotify( gpointer data )
+    {
+
+        // widget is being finalized. Remove remaining data from clients
+        Record* record( static_cast<Record*>( data ) );
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::WidgetRegistry::destroyNotify - " << record->_widget << " slots: " << record->_count << std::endl;
+        #endif
+
+        for( int i = 0; i < MaxSlots && record->_count > 0; ++i )
+        {
+            if( !record->_slots[i] ) continue;
+            if( _clients[i] ) _clients[i]->finalizeSlot( record->_widget, record->_slots[i] );
+            record->setSlot( i, 0L );
+        }
+
+        unlink( *record );
+        delete record;
+
+    }
+
+    //____________________________________________________________________
+    void WidgetRegistry::weakNotify( gpointer data, GObject* )
+    {
+
+        // widget is being disposed. Its qdata, and thus the record, are still valid
+        Record* record( static_cast<Record*>( data ) );
+        GtkWidget* widget( record->_widget );
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::WidgetRegistry::weakNotify - " << widget << " listeners: " << record->_listeners.size() << std::endl;
+        #endif
+
+        // weak reference is consumed
+        record->_weakRef = false;
+        record->_disposed = true;
+
+        /*
+        call listeners one at a time, since callbacks might remove other listeners,
+        or release the record
+        */
+        while( ( record = find( widget ) ) && !record->_listeners.empty() )
+        {
+            const Record::Listener listener( record->_listeners.front() );
+            record->_listeners.erase( record->_listeners.begin() );
+            (listener._callback)( widget, listener._data );
+        }
+
+        // delete record if not used anymore
+        if( record ) release( *record );
+
+    }
+
+    //____________________________________________________________________
+    void WidgetRegistry::unlink( Record& record )
+    {
+
+        if( record._previous ) record._previous->_next = record._next;
+        else _first = record._next;
+
+        if( record._next ) record._next->_previous = record._previous;
+
+    }
+
+}
@@ -0,0 +1,211 @@
+#ifndef oxygenwidgetregistry_h
+#define oxygenwidgetregistry_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include <gtk/gtk.h>
+#include <vector>
+
+namespace Oxygen
+{
+
+    //! attaches a single record to each registered widget, using GObject qdata
+    /*!
+    the record holds one slot per DataMap, pointing to the data stored for this widget, as well
+    as a bitmask of the engines the widget is registered to. This turns data lookup into a pointer chase,
+    and allows to only notify the relevant engines when the widget is destroyed.
+
+    The record also holds the list of callbacks to be called when the widget is destroyed.
+    They are triggered by a single weak reference on the widget, rather than one "destroy" signal
+    connection each.
+    */
+    class WidgetRegistry
+    {
+
+        public:
+
+        //! max number of slots, and engines
+        enum { MaxSlots = 32 };
+
+        //! destroy callback
+        /*! the return value is ignored. It matches the one of "destroy" signal callbacks */
+        typedef gboolean (*DestroyCallback)( GtkWidget*, gpointer );
+
+        //! slot owner
+        class Client
+        {
+            public:
+
+            //! destructor
+            virtual ~Client( void )
+            {}
+
+            //! called when widget is finalized while its slot is still in use
+            virtual void finalizeSlot( GtkWidget*, void* ) = 0;
+
+        };
+
+        //! per widget record
+        class Record
+        {
+
+            public:
+
+            //! constructor
+            explicit Record( GtkWidget* widget ):
+                _widget( widget ),
+                _count( 0 ),
+                _engines( 0 ),
+                _weakRef( false ),
+                _disposed( false ),
+                _previous( 0L ),
+                _next( 0L )
+            {
+                for( int i = 0; i < MaxSlots; ++i )
+                { _slots[i] = 0L; }
+            }
+
+            //! true if record is not used anymore
+            bool isEmpty( void ) const
+            { return _count == 0 && _engines == 0 && _listeners.empty() && !_weakRef; }
+
+            //! slot
+            void* slot( int index ) const
+            { return _slots[index]; }
+
+            //! set slot
+            void setSlot( int index, void* value )
+            {
+                if( _slots[index] ) --_count;
+                if( value ) ++_count;
+                _slots[index] = value;
+            }
+
+            //! widget
+            GtkWidget* _widget;
+
+            //! number of used slots
+            int _count;
+
+            //! data slots
+            void* _slots[MaxSlots];
+
+            //! registered engines bitmask
+            guint32 _engines;
+
+            //! destroy listener
+            class Listener
+            {
+                public:
+
+                //! constructor
+                Listener( DestroyCallback callback, gpointer data ):
+                    _callback( callback ),
+                    _data( data )
+                {}
+
+                //! equal to operator
+                bool operator == ( const Listener& other ) const
+                { return _callback == other._callback && _data == other._data; }
+
+                //! callback
+                DestroyCallback _callback;
+
+                //! data
+                gpointer _data;
+
+            };
+
+            typedef std::vector<Listener> ListenerList;
+
+            //! destroy listeners
+            ListenerList _listeners;
+
+            //! true if weak reference is set on the widget
+            bool _weakRef;
+
+            //! true once widget is being disposed
+            bool _disposed;
+
+            //! previous record
+            Record* _previous;
+
+            //! next record
+            Record* _next;
+
+        };
+
+        //! register client, returns matching slot index
+        static int registerClient( Client* );
+
+        //! unregister client
+        static void unregisterClient( int );
+
+        //! find record associated to widget, if any
+        static Record* find( GtkWidget* widget )
+        { return widget ? static_cast<Record*>( g_object_get_qdata( G_OBJECT( widget ), quark() ) ) : 0L; }
+
+        //! find record associated to widget, create if needed
+        static Record& get( GtkWidget* );
+
+        //! delete record if not used anymore
+        static void release( Record& );
+
+        //! add callback to be called when widget is destroyed
+        /*! nothing is done if the same callback and data are already registered */
+        static void addDestroyNotify( GtkWidget*, DestroyCallback, gpointer );
+
+        //! remove destroy callback
+        static void removeDestroyNotify( GtkWidget*, DestroyCallback, gpointer );
+
+        //! first record, for iteration
+        static Record* first( void )
+        { return _first; }
+
+        protected:
+
+        //! quark
+        static GQuark quark( void );
+
+        //! qdata destroy notification
+        static void destroyNotify( gpointer );
+
+        //! weak reference notification
+        static void weakNotify( gpointer, GObject* );
+
+        //! remove record from list
+        static void unlink( Record& );
+
+        private:
+
+        //! quark
+        static GQuark _quark;
+
+        //! registered clients
+        static Client* _clients[MaxSlots];
+
+        //! first record
+        static Record* _first;
+
+    };
+
+}
+
+#endif
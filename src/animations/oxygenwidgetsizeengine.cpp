@@ -0,0 +1,76 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenwidgetsizeengine.h"
+#include "../oxygenstyle.h"
+#include "../config.h"
+
+#include <iostream>
+
+namespace Oxygen
+{
+
+    //________________________________________________________
+    void WidgetSizeEngine::scheduleUpdate( GtkWidget* widget, unsigned int flags )
+    {
+
+        if( !flags ) return;
+        _pendingUpdates[widget] |= flags;
+        if( !_timer.isRunning() )
+        { _timer.start( 0, (GSourceFunc)delayedUpdate, this ); }
+
+    }
+
+    //________________________________________________________
+    gboolean WidgetSizeEngine::delayedUpdate( gpointer pointer )
+    {
+
+        WidgetSizeEngine& engine( *static_cast<WidgetSizeEngine*>( pointer ) );
+
+        UpdateMap updates;
+        updates.swap( engine._pendingUpdates );
+        for( UpdateMap::const_iterator iter = updates.begin(); iter != updates.end(); ++iter )
+        {
+
+            // widget might have been hidden in between
+            GtkWidget* widget( iter->first );
+            if( !( engine.contains( widget ) && gtk_widget_get_realized( widget ) ) ) continue;
+
+            const WidgetSizeData& data( engine.data().value( widget ) );
+
+            #if OXYGEN_DEBUG
+            std::cerr
+                << "Oxygen::WidgetSizeEngine::delayedUpdate - "
+                << widget << " (" << G_OBJECT_TYPE_NAME( widget ) << ")"
+                << " size: " << data.width() << "x" << data.height()
+                << " alpha: " << data.alpha()
+                << std::endl;
+            #endif
+
+            if( iter->second & UpdateMask ) Style::instance().adjustMask( widget, data.width(), data.height(), data.alpha() );
+            if( iter->second & UpdateBlur ) Style::instance().setWindowBlur( widget, data.alpha() );
+
+        }
+
+        return FALSE;
+
+    }
+
+}
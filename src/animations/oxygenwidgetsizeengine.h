@@ -23,9 +23,11 @@
 
 #include "oxygengenericengine.h"
 #include "oxygendatamap.h"
+#include "oxygentimer.h"
 #include "oxygenwidgetsizedata.h"
 
 #include <gtk/gtk.h>
+#include <map>
 
 namespace Oxygen
 {
@@ -51,6 +53,27 @@ namespace Oxygen
         virtual ~WidgetSizeEngine( void )
         {}
 
+        //! unregister widget
+        virtual void unregisterWidget( GtkWidget* widget )
+        {
+            _pendingUpdates.erase( widget );
+            GenericEngine<WidgetSizeData>::unregisterWidget( widget );
+        }
+
+        //! deferred X11 updates
+        enum UpdateFlag
+        {
+            UpdateMask = 1<<0,
+            UpdateBlur = 1<<1
+        };
+
+        //! schedule window mask and/or blur update, at next main loop iteration
+        /*!
+        requests made for the same widget during one iteration are merged,
+        and use the last stored size and alpha
+        */
+        void scheduleUpdate( GtkWidget*, unsigned int );
+
         //! update window XShape for given widget
         WidgetSizeData::ChangedFlags update( GtkWidget* widget )
         { return data().value( widget ).update(); }
@@ -67,6 +90,20 @@ namespace Oxygen
         bool alpha( GtkWidget* widget )
         { return data().value( widget ).alpha(); }
 
+        protected:
+
+        //! perform pending updates
+        static gboolean delayedUpdate( gpointer );
+
+        private:
+
+        //! pending updates
+        typedef std::map<GtkWidget*, unsigned int> UpdateMap;
+        UpdateMap _pendingUpdates;
+
+        //! update timer
+        Timer _timer;
+
     };
 
 }
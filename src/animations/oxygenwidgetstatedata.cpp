@@ -19,6 +19,7 @@
 */
 
 #include "oxygenwidgetstatedata.h"
+#include "oxygentimelineserver.h"
 #include "../config.h"
 
 #include <iostream>
@@ -96,7 +97,7 @@ namespace Oxygen
         #endif
 
         if( data._target && gtk_widget_get_realized(data._target) )
-        { Gtk::gtk_widget_queue_draw( data._target, &data._dirtyRect ); }
+        { TimeLineServer::instance().queueDraw( data._target, &data._dirtyRect ); }
 
         return FALSE;
 
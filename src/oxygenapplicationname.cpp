@@ -37,6 +37,11 @@
 namespace Oxygen
 {
 
+    //__________________________________________________________________________
+    Hook ApplicationName::_hierarchyHook;
+    bool ApplicationName::_hierarchyHookInitialized = false;
+    GQuark ApplicationName::_dialogQuark = 0;
+
     //__________________________________________________________________________
     void ApplicationName::initialize( void )
     {
@@ -111,10 +116,69 @@ namespace Oxygen
     //__________________________________________________________________________
     bool ApplicationName::isGtkDialogWidget( GtkWidget* widget ) const
     {
+
+        // check cached value
+        const guint state( GPOINTER_TO_UINT( g_object_get_qdata( G_OBJECT( widget ), dialogQuark() ) ) );
+        if( state != DialogStateUnknown ) return state == DialogWidget;
+
         GtkWidget* parent( gtk_widget_get_toplevel( widget ) );
 
         // check parent
-        return parent && GTK_IS_DIALOG( parent );
+        const bool out( parent && GTK_IS_DIALOG( parent ) );
+
+        /*
+        only cache value once widget is inside a window, since hierarchy-changed is only emitted
+        when the widget gets or loses its toplevel window
+        */
+        if( parent && GTK_IS_WINDOW( parent ) )
+        {
+            initializeHierarchyHook();
+            g_object_set_qdata( G_OBJECT( widget ), dialogQuark(), GUINT_TO_POINTER( out ? DialogWidget:NotDialogWidget ) );
+        }
+
+        return out;
+
+    }
+
+    //__________________________________________________________________________
+    void ApplicationName::initializeHierarchyHook( void )
+    {
+        if( _hierarchyHookInitialized ) return;
+        _hierarchyHook.connect( "hierarchy-changed", (GSignalEmissionHook)hierarchyChangedHook, 0L );
+        _hierarchyHookInitialized = true;
+    }
+
+    //__________________________________________________________________________
+    void ApplicationName::disconnectHooks( void )
+    {
+        if( !_hierarchyHookInitialized ) return;
+        _hierarchyHook.disconnect();
+        _hierarchyHookInitialized = false;
+    }
+
+    //__________________________________________________________________________
+    gboolean ApplicationName::hierarchyChangedHook( GSignalInvocationHint*, guint, const GValue* params, gpointer )
+    {
+
+        // get widget from params
+        GtkWidget* widget( GTK_WIDGET( g_value_get_object( params ) ) );
+
+        // check type
+        if( !GTK_IS_WIDGET( widget ) ) return FALSE;
+
+        // invalidate cached value
+        if( g_object_get_qdata( G_OBJECT( widget ), dialogQuark() ) )
+        { g_object_set_qdata( G_OBJECT( widget ), dialogQuark(), 0L ); }
+
+        return TRUE;
+
+    }
+
+    //__________________________________________________________________________
+    GQuark ApplicationName::dialogQuark( void )
+    {
+        if( !_dialogQuark ) _dialogQuark = g_quark_from_static_string( "oxygen-application-name-dialog" );
+        return _dialogQuark;
     }
 
     //__________________________________________________________________________
@@ -25,6 +25,8 @@
 * MA 02110-1301, USA.
 */
 
+#include "oxygenhook.h"
+
 #include <gtk/gtk.h>
 #include <iostream>
 #include <string>
@@ -104,11 +106,24 @@ namespace Oxygen
 
         //@}
 
+        //! disconnect hook used to invalidate cached per-widget values
+        static void disconnectHooks( void );
+
         protected:
 
         //! determine if widget is on a GtkDialog
+        /*! result is cached per widget, and invalidated when the widget hierarchy changes */
         bool isGtkDialogWidget( GtkWidget* ) const;
 
+        //! install hierarchy-changed hook, used to invalidate cached values
+        static void initializeHierarchyHook( void );
+
+        //! hierarchy-changed hook
+        static gboolean hierarchyChangedHook( GSignalInvocationHint*, guint, const GValue*, gpointer );
+
+        //! quark used to store cached dialog state
+        static GQuark dialogQuark( void );
+
         //! get application name from Gtk
         std::string fromGtk( void ) const;
 
@@ -117,11 +132,28 @@ namespace Oxygen
 
         private:
 
+        //! cached dialog state
+        enum DialogState
+        {
+            DialogStateUnknown,
+            NotDialogWidget,
+            DialogWidget
+        };
+
         //! name
         AppName _name;
 
         const char* _version;
 
+        //! hierarchy-changed hook
+        static Hook _hierarchyHook;
+
+        //! true when hierarchy hook is connected
+        static bool _hierarchyHookInitialized;
+
+        //! quark used to store cached dialog state
+        static GQuark _dialogQuark;
+
         //! streamer (for debugging)
         friend std::ostream& operator << ( std::ostream&, const ApplicationName& );
 
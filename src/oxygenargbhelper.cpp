@@ -22,6 +22,7 @@
 */
 
 #include "oxygenargbhelper.h"
+#include "oxygengtktypeflags.h"
 #include "oxygengtktypenames.h"
 #include "config.h"
 
@@ -79,7 +80,7 @@ namespace Oxygen
 
         // check type
         if( !GTK_IS_WIDGET( widget ) ) return FALSE;
-        if( !GTK_IS_WINDOW( widget ) ) return TRUE;
+        if( !Gtk::TypeFlags::test( widget, Gtk::TypeFlags::Window ) ) return TRUE;
 
         // make sure widget has not been realized already
         #if GTK_CHECK_VERSION(2, 20, 0)
@@ -0,0 +1,112 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenbackgroundcache.h"
+#include "config.h"
+
+#include <iostream>
+
+namespace Oxygen
+{
+
+    //_________________________________________________
+    cairo_surface_t* BackgroundCache::find( const Key& key, GdkRectangle& rect ) const
+    {
+
+        for( EntryList::const_iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        {
+
+            if( !( iter->_key == key ) ) continue;
+
+            // check that rect is fully covered
+            GdkRectangle intersection;
+            if( !gdk_rectangle_intersect( &iter->_extents, &rect, &intersection ) ) return 0L;
+            if( intersection.x != rect.x || intersection.y != rect.y || intersection.width != rect.width || intersection.height != rect.height ) return 0L;
+
+            rect = iter->_extents;
+            return iter->_surface;
+
+        }
+
+        return 0L;
+
+    }
+
+    //_________________________________________________
+    cairo_surface_t* BackgroundCache::create( const Key& key, const GdkRectangle& rect, cairo_surface_t* target )
+    {
+
+        // one surface per key and expose
+        for( EntryList::const_iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        { if( iter->_key == key ) return 0L; }
+
+        if( _entries.size() >= MaxSize ) return 0L;
+        if( rect.width <= 0 || rect.height <= 0 ) return 0L;
+
+        // create surface similar to target, so that copying to it is cheap
+        cairo_surface_t* surface( cairo_surface_create_similar( target, key._alpha ? CAIRO_CONTENT_COLOR_ALPHA:CAIRO_CONTENT_COLOR, rect.width, rect.height ) );
+        if( cairo_surface_status( surface ) != CAIRO_STATUS_SUCCESS )
+        {
+            cairo_surface_destroy( surface );
+            return 0L;
+        }
+
+        // window is referenced so that its address is not reused while the entry exists
+        g_object_ref( key._toplevel );
+        _entries.push_back( Entry( key, rect, surface ) );
+
+        // release surfaces at next main loop iteration
+        if( !_timer.isRunning() )
+        { _timer.start( 0, (GSourceFunc)delayedClear, this ); }
+
+        return surface;
+
+    }
+
+    //_________________________________________________
+    void BackgroundCache::clear( void )
+    {
+
+        for( EntryList::iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        {
+            cairo_surface_destroy( iter->_surface );
+            g_object_unref( iter->_key._toplevel );
+        }
+
+        _entries.clear();
+
+    }
+
+    //_________________________________________________
+    gboolean BackgroundCache::delayedClear( gpointer data )
+    {
+
+        BackgroundCache& cache( *static_cast<BackgroundCache*>( data ) );
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::BackgroundCache::delayedClear - entries: " << cache._entries.size() << std::endl;
+        #endif
+
+        cache.clear();
+        return FALSE;
+
+    }
+
+}
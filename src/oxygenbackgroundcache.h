@@ -0,0 +1,154 @@
+#ifndef oxygenbackgroundcache_h
+#define oxygenbackgroundcache_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenrgba.h"
+#include "oxygentimer.h"
+
+#include <cairo.h>
+#include <gdk/gdk.h>
+#include <vector>
+
+namespace Oxygen
+{
+
+    //! keeps window background gradient rendered during the current expose, in toplevel coordinates
+    /*!
+    nested containers request the window background for overlapping rectangles of the same toplevel.
+    The first request renders the gradient into an offscreen surface, covering the requested rectangle.
+    Subsequent requests that fall inside are copied from it, which gives the same result as rendering again.
+    Surfaces are released at the next main loop iteration, once exposure is done.
+    */
+    class BackgroundCache
+    {
+
+        public:
+
+        //! constructor
+        BackgroundCache( void )
+        {}
+
+        //! destructor
+        virtual ~BackgroundCache( void )
+        { clear(); }
+
+        //! rendering parameters
+        class Key
+        {
+
+            public:
+
+            //! constructor
+            Key( GdkWindow* toplevel, const ColorUtils::Rgba& base, gint width, gint height, bool alpha ):
+                _toplevel( toplevel ),
+                _base( base ),
+                _width( width ),
+                _height( height ),
+                _alpha( alpha )
+            {}
+
+            //! equal to operator
+            bool operator == ( const Key& other ) const
+            {
+                return
+                    _toplevel == other._toplevel &&
+                    _base == other._base &&
+                    _width == other._width &&
+                    _height == other._height &&
+                    _alpha == other._alpha;
+            }
+
+            //! toplevel window
+            GdkWindow* _toplevel;
+
+            //! base color
+            ColorUtils::Rgba _base;
+
+            //! toplevel dimensions
+            gint _width;
+            gint _height;
+
+            //! true if window background is translucent
+            bool _alpha;
+
+        };
+
+        //! surface matching key, if it covers given rectangle, in toplevel coordinates
+        /*! rect is modified to the surface extents. Returns 0L if no surface is found */
+        cairo_surface_t* find( const Key&, GdkRectangle& ) const;
+
+        //! create new surface for key, covering given rectangle, in toplevel coordinates
+        /*! returns 0L if a surface already exists for this key */
+        cairo_surface_t* create( const Key&, const GdkRectangle&, cairo_surface_t* target );
+
+        //! release all surfaces
+        void clear( void );
+
+        protected:
+
+        //! delayed clear
+        static gboolean delayedClear( gpointer );
+
+        private:
+
+        //! copy constructor is private
+        BackgroundCache( const BackgroundCache& )
+        {}
+
+        //! cached surface
+        class Entry
+        {
+
+            public:
+
+            //! constructor
+            Entry( const Key& key, const GdkRectangle& extents, cairo_surface_t* surface ):
+                _key( key ),
+                _extents( extents ),
+                _surface( surface )
+            {}
+
+            //! key
+            Key _key;
+
+            //! surface extents, in toplevel coordinates
+            GdkRectangle _extents;
+
+            //! surface
+            cairo_surface_t* _surface;
+
+        };
+
+        //! max number of cached surfaces
+        enum { MaxSize = 8 };
+
+        //! cached surfaces
+        typedef std::vector<Entry> EntryList;
+        EntryList _entries;
+
+        //! clear timer
+        Timer _timer;
+
+    };
+
+}
+
+#endif
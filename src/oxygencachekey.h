@@ -857,6 +857,41 @@ namespace Oxygen
         int _size;
     };
 
+    //! key for rounded mask regions
+    class RoundRegionKey
+    {
+        public:
+
+        //! constructor
+        RoundRegionKey( int width, int height, int radius ):
+            _width(width),
+            _height(height),
+            _radius(radius)
+        {}
+
+        //! equal to operator
+        bool operator == (const RoundRegionKey& other) const
+        {
+            return _width == other._width &&
+                _height == other._height &&
+                _radius == other._radius;
+        }
+
+        //! less than operator
+        bool operator < (const RoundRegionKey& other) const
+        {
+            if( _width != other._width ) return _width < other._width;
+            else if( _height != other._height ) return _height < other._height;
+            else return _radius < other._radius;
+        }
+
+        private:
+
+        int _width;
+        int _height;
+        int _radius;
+    };
+
 }
 
 #endif
@@ -19,24 +19,31 @@
 */
 
 #include "oxygencairocontext.h"
+#include "oxygencairocontextcache.h"
 #include <gdk/gdk.h>
 namespace Oxygen
 {
 
     //_________________________________________-
     Cairo::Context::Context( GdkWindow* window, GdkRectangle* clipRect):
-        _cr( 0L )
+        _cr( 0L ),
+        _cached( false )
     {
 
         if( !GDK_IS_DRAWABLE(window) ) return;
-        _cr= static_cast<cairo_t*>( gdk_cairo_create(window) );
+
+        // reuse context created earlier during the same expose, if any
+        if( ( _cr = ContextCache::instance().acquire( window ) ) ) _cached = true;
+        else _cr= static_cast<cairo_t*>( gdk_cairo_create(window) );
+
         setClipping( clipRect );
 
     }
 
     //_________________________________________-
     Cairo::Context::Context( cairo_surface_t* surface, GdkRectangle* clipRect):
-        _cr( 0L )
+        _cr( 0L ),
+        _cached( false )
     {
 
         _cr= static_cast<cairo_t*>( cairo_create(surface) );
@@ -49,8 +56,12 @@ namespace Oxygen
     {
         if( _cr ) {
 
-            cairo_destroy( _cr );
+            // cached contexts are only restored, and destroyed later by the cache
+            if( !( _cached && ContextCache::instance().release( _cr ) ) )
+            { cairo_destroy( _cr ); }
+
             _cr = 0L;
+            _cached = false;
 
         }
     }
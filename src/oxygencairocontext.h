@@ -67,12 +67,14 @@ namespace Oxygen
 
             //! empty constructor is private
             explicit Context( void ):
-                _cr( 0L )
+                _cr( 0L ),
+                _cached( false )
             { assert( false ); }
 
             //! copy constructor is private
             Context( const Context& other ):
-                _cr( 0L )
+                _cr( 0L ),
+                _cached( false )
             { assert( false ); }
 
             //! equal to operator is private
@@ -93,6 +95,9 @@ namespace Oxygen
             //! cairo contect
             cairo_t* _cr;
 
+            //! true if context belongs to ContextCache
+            bool _cached;
+
         };
 
     }
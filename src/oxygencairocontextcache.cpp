@@ -0,0 +1,191 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygencairocontextcache.h"
+#include "config.h"
+
+#include <iostream>
+
+namespace Oxygen
+{
+
+    //_________________________________________________
+    Cairo::ContextCache* Cairo::ContextCache::_instance = 0L;
+    Cairo::ContextCache& Cairo::ContextCache::instance( void )
+    {
+        if( !_instance ) _instance = new ContextCache();
+        return *_instance;
+    }
+
+    //_________________________________________________
+    Cairo::ContextCache::~ContextCache( void )
+    {
+        clear();
+        _instance = 0L;
+    }
+
+    //_________________________________________________
+    cairo_t* Cairo::ContextCache::acquire( GdkWindow* window )
+    {
+
+        // only windows are cached. Pixmaps are painted directly
+        if( !GDK_IS_WINDOW( window ) ) return 0L;
+
+        // get drawable the window currently paints to
+        GdkDrawable* drawable( 0L );
+        gint xOffset( 0 );
+        gint yOffset( 0 );
+        gdk_window_get_internal_paint_info( window, &drawable, &xOffset, &yOffset );
+
+        for( EntryList::iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        {
+
+            if( iter->_window != window ) continue;
+
+            // nested users get their own context, so that paths do not interfere
+            if( iter->_depth > 0 ) return 0L;
+
+            if( iter->_drawable == drawable && iter->_xOffset == xOffset && iter->_yOffset == yOffset && cairo_status( iter->_cr ) == CAIRO_STATUS_SUCCESS )
+            {
+
+                ++iter->_depth;
+                cairo_new_path( iter->_cr );
+                cairo_save( iter->_cr );
+                return iter->_cr;
+
+            }
+
+            // window paints somewhere else. Context is obsolete
+            free( *iter );
+            _entries.erase( iter );
+            break;
+
+        }
+
+        // make room for new entry
+        if( _entries.size() >= MaxSize )
+        {
+
+            EntryList::iterator iter( _entries.begin() );
+            while( iter != _entries.end() && iter->_depth > 0 ) ++iter;
+            if( iter == _entries.end() ) return 0L;
+
+            free( *iter );
+            _entries.erase( iter );
+
+        }
+
+        // create entry
+        /* window and drawable are referenced, so that their addresses are not reused while the entry exists */
+        Entry entry;
+        entry._window = GDK_WINDOW( g_object_ref( window ) );
+        entry._drawable = drawable ? GDK_DRAWABLE( g_object_ref( drawable ) ):0L;
+        entry._xOffset = xOffset;
+        entry._yOffset = yOffset;
+        entry._cr = gdk_cairo_create( window );
+        entry._depth = 1;
+        _entries.push_back( entry );
+
+        // destroy contexts at next main loop iteration
+        if( !_timer.isRunning() )
+        { _timer.start( 0, (GSourceFunc)delayedClear, this ); }
+
+        cairo_save( entry._cr );
+        return entry._cr;
+
+    }
+
+    //_________________________________________________
+    bool Cairo::ContextCache::release( cairo_t* cr )
+    {
+
+        for( EntryList::iterator iter = _entries.begin(); iter != _entries.end(); ++iter )
+        {
+
+            if( iter->_cr != cr ) continue;
+
+            cairo_restore( cr );
+            --iter->_depth;
+
+            // drop context if its state is invalid
+            if( iter->_depth == 0 && cairo_status( cr ) != CAIRO_STATUS_SUCCESS )
+            {
+                free( *iter );
+                _entries.erase( iter );
+            }
+
+            return true;
+
+        }
+
+        return false;
+
+    }
+
+    //_________________________________________________
+    void Cairo::ContextCache::clear( void )
+    {
+
+        EntryList::iterator iter( _entries.begin() );
+        while( iter != _entries.end() )
+        {
+
+            if( iter->_depth > 0 ) ++iter;
+            else {
+
+                free( *iter );
+                iter = _entries.erase( iter );
+
+            }
+
+        }
+
+    }
+
+    //_________________________________________________
+    gboolean Cairo::ContextCache::delayedClear( gpointer data )
+    {
+
+        ContextCache& cache( *static_cast<ContextCache*>( data ) );
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::Cairo::ContextCache::delayedClear - entries: " << cache._entries.size() << std::endl;
+        #endif
+
+        cache.clear();
+        return FALSE;
+
+    }
+
+    //_________________________________________________
+    void Cairo::ContextCache::free( Entry& entry ) const
+    {
+
+        if( entry._cr ) cairo_destroy( entry._cr );
+        if( entry._drawable ) g_object_unref( entry._drawable );
+        if( entry._window ) g_object_unref( entry._window );
+
+        entry._cr = 0L;
+        entry._drawable = 0L;
+        entry._window = 0L;
+
+    }
+
+}
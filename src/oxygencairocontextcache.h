@@ -0,0 +1,137 @@
+#ifndef oxygencairocontextcache_h
+#define oxygencairocontextcache_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygentimer.h"
+
+#include <cairo.h>
+#include <gdk/gdk.h>
+#include <vector>
+
+namespace Oxygen
+{
+    namespace Cairo
+    {
+
+        //! keeps cairo contexts created on windows, for reuse by subsequent draw calls
+        /*!
+        a context is reused as long as the window paints to the same drawable, with the same offsets,
+        which is the case for the duration of a given expose event. Each user gets the context with its state saved,
+        and restored when released. Contexts are destroyed at the next main loop iteration, once exposure is done.
+        */
+        class ContextCache
+        {
+
+            public:
+
+            //! singleton
+            static ContextCache& instance( void );
+
+            //! destructor
+            virtual ~ContextCache( void );
+
+            //! context for given window, or 0L if none can be reused
+            cairo_t* acquire( GdkWindow* );
+
+            //! release context obtained from acquire
+            /*! returns false if context does not belong to the cache */
+            bool release( cairo_t* );
+
+            //! context for given window, reused from cache if possible, created otherwise
+            cairo_t* create( GdkWindow* window )
+            {
+                cairo_t* context( acquire( window ) );
+                return context ? context : gdk_cairo_create( window );
+            }
+
+            //! release context obtained from create
+            void destroy( cairo_t* context )
+            { if( !release( context ) ) cairo_destroy( context ); }
+
+            //! destroy all contexts that are not in use
+            void clear( void );
+
+            protected:
+
+            //! delayed clear
+            static gboolean delayedClear( gpointer );
+
+            private:
+
+            //! constructor is private
+            ContextCache( void )
+            {}
+
+            //! cached context
+            class Entry
+            {
+
+                public:
+
+                //! constructor
+                Entry( void ):
+                    _window( 0L ),
+                    _drawable( 0L ),
+                    _xOffset( 0 ),
+                    _yOffset( 0 ),
+                    _cr( 0L ),
+                    _depth( 0 )
+                {}
+
+                //! window
+                GdkWindow* _window;
+
+                //! drawable the window was painting to when context was created
+                GdkDrawable* _drawable;
+
+                //! offsets between window and drawable
+                gint _xOffset;
+                gint _yOffset;
+
+                //! context
+                cairo_t* _cr;
+
+                //! number of users
+                int _depth;
+
+            };
+
+            //! destroy entry content
+            void free( Entry& ) const;
+
+            //! max number of cached contexts
+            enum { MaxSize = 8 };
+
+            //! cached contexts
+            typedef std::vector<Entry> EntryList;
+            EntryList _entries;
+
+            //! clear timer
+            Timer _timer;
+
+            //! singleton
+            static ContextCache* _instance;
+
+        };
+
+    }
+}
+#endif
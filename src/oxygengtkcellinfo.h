@@ -22,6 +22,7 @@
 
 #include "oxygenflags.h"
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 #include <gdk/gdk.h>
@@ -91,6 +92,14 @@ namespace Oxygen
             bool operator != (const CellInfo& other ) const
             { return !( sameColumn( other ) && samePath( other )); }
 
+            //! swap content with other cell info
+            /*! avoids copying the path when storing a newly constructed cell info */
+            void swap( CellInfo& other )
+            {
+                std::swap( _path, other._path );
+                std::swap( _column, other._column );
+            }
+
             //! clear
             void clear( void )
             {
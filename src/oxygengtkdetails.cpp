@@ -0,0 +1,161 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2010 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygengtkdetails.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Oxygen
+{
+
+    //! detail name and matching type
+    class DetailEntry
+    {
+        public:
+
+        const char* _name;
+        Gtk::Detail::Type _type;
+
+    };
+
+    //! used to find detail entry by name
+    class DetailEntryLessFTor
+    {
+        public:
+
+        bool operator() ( const DetailEntry& entry, const char* name ) const
+        { return strcmp( entry._name, name ) < 0; }
+
+    };
+
+    //____________________________________________________________________________
+    void Gtk::Detail::parse( const char* value )
+    {
+
+        // treeview cells. All remaining information is stored in flags
+        if( !strncmp( value, "cell_", 5 ) )
+        {
+            _type = Cell;
+            parseCellFlags( value + 5 );
+            return;
+        }
+
+        // infobars come with their message type as suffix
+        if( !strncmp( value, "infobar", 7 ) )
+        {
+            _type = InfoBar;
+            return;
+        }
+
+        // known details, sorted by name
+        static const DetailEntry entries[] =
+        {
+            { "arrow", Arrow },
+            { "bar", Bar },
+            { "base", Base },
+            { "button", Button },
+            { "buttondefault", DefaultButton },
+            { "cellcheck", CellCheck },
+            { "cellradio", CellRadio },
+            { "check", Check },
+            { "checkbutton", CheckButton },
+            { "dnd", DragAndDrop },
+            { "dockitem", DockItem },
+            { "entry", Entry },
+            { "entry-progress", EntryProgress },
+            { "entry_bg", EntryBg },
+            { "eventbox", EventBox },
+            { "expander", Expander },
+            { "frame", Frame },
+            { "handlebox", HandleBox },
+            { "handlebox_bin", HandleBoxBin },
+            { "hruler", HRuler },
+            { "hscale", HScale },
+            { "hscrollbar", HScrollBar },
+            { "icon_view_item", IconViewItem },
+            { "menu", Menu },
+            { "menu_scroll_arrow_down", MenuScrollArrowDown },
+            { "menu_scroll_arrow_up", MenuScrollArrowUp },
+            { "menubar", MenuBar },
+            { "menuitem", MenuItem },
+            { "notebook", Notebook },
+            { "option", Option },
+            { "optionmenu", OptionMenu },
+            { "optionmenutab", OptionMenuTab },
+            { "paned", Paned },
+            { "progressbar", ProgressBar },
+            { "radiobutton", RadioButton },
+            { "scrolled_window", ScrolledWindow },
+            { "slider", Slider },
+            { "spinbutton", SpinButton },
+            { "spinbutton_down", SpinButtonDown },
+            { "spinbutton_up", SpinButtonUp },
+            { "stepper", Stepper },
+            { "tab", Tab },
+            { "tearoffmenuitem", TearOffMenuItem },
+            { "togglebutton", ToggleButton },
+            { "toolbar", ToolBar },
+            { "tooltip", Tooltip },
+            { "treeview", TreeView },
+            { "trough", Trough },
+            { "trough-fill-level", TroughFillLevel },
+            { "trough-lower", TroughLower },
+            { "trough-upper", TroughUpper },
+            { "viewport", Viewport },
+            { "viewportbin", ViewportBin },
+            { "vruler", VRuler },
+            { "vscale", VScale },
+            { "vscrollbar", VScrollBar }
+        };
+
+        static const DetailEntry* end( entries + sizeof( entries )/sizeof( DetailEntry ) );
+        const DetailEntry* entry( std::lower_bound( entries, end, value, DetailEntryLessFTor() ) );
+        _type = ( entry != end && !strcmp( entry->_name, value ) ) ? entry->_type : Unknown;
+
+    }
+
+    //____________________________________________________________________________
+    void Gtk::Detail::parseCellFlags( const char* value )
+    {
+
+        // cell details are made of underscore separated tokens, e.g. cell_odd_ruled_sorted_start
+        while( *value )
+        {
+
+            const char* next( strchr( value, '_' ) );
+            const size_t length( next ? size_t( next - value ) : strlen( value ) );
+
+            if( length == 3 && !strncmp( value, "odd", 3 ) ) _flags |= CellOdd;
+            else if( length == 4 && !strncmp( value, "even", 4 ) ) _flags |= CellEven;
+            else if( length == 5 && !strncmp( value, "ruled", 5 ) ) _flags |= CellRuled;
+            else if( length == 6 && !strncmp( value, "sorted", 6 ) ) _flags |= CellSorted;
+            else if( length == 5 && !strncmp( value, "start", 5 ) ) _flags |= CellStart;
+            else if( length == 6 && !strncmp( value, "middle", 6 ) ) _flags |= CellMiddle;
+            else if( length == 3 && !strncmp( value, "end", 3 ) ) _flags |= CellEnd;
+
+            if( !next ) break;
+            value = next + 1;
+
+        }
+
+    }
+
+}
@@ -20,135 +20,245 @@
 * MA 02110-1301, USA.
 */
 
-#include<string>
+#include <cstring>
+
 namespace Oxygen
 {
     namespace Gtk
     {
 
+        //! gtk detail string
+        /*!
+        the detail is parsed once, at construction, into a type and, for treeview cells, a set of flags,
+        so that all predicates are integer comparisons. Use type() to dispatch with a switch.
+        */
         class Detail
         {
             public:
 
+            //! known details
+            enum Type
+            {
+                Null,
+                Unknown,
+                Arrow,
+                Bar,
+                Base,
+                Button,
+                Cell,
+                CellCheck,
+                CellRadio,
+                Check,
+                CheckButton,
+                DefaultButton,
+                DockItem,
+                DragAndDrop,
+                Entry,
+                EntryBg,
+                EntryProgress,
+                EventBox,
+                Expander,
+                Frame,
+                HRuler,
+                HScale,
+                HScrollBar,
+                HandleBox,
+                HandleBoxBin,
+                IconViewItem,
+                InfoBar,
+                Menu,
+                MenuBar,
+                MenuItem,
+                MenuScrollArrowDown,
+                MenuScrollArrowUp,
+                Notebook,
+                Option,
+                OptionMenu,
+                OptionMenuTab,
+                Paned,
+                ProgressBar,
+                RadioButton,
+                ScrolledWindow,
+                Slider,
+                SpinButton,
+                SpinButtonDown,
+                SpinButtonUp,
+                Stepper,
+                Tab,
+                TearOffMenuItem,
+                ToggleButton,
+                ToolBar,
+                Tooltip,
+                TreeView,
+                Trough,
+                TroughFillLevel,
+                TroughLower,
+                TroughUpper,
+                VRuler,
+                VScale,
+                VScrollBar,
+                Viewport,
+                ViewportBin
+            };
+
+            //! treeview cell flags
+            enum CellFlag
+            {
+                CellEven = 1<<0,
+                CellOdd = 1<<1,
+                CellRuled = 1<<2,
+                CellSorted = 1<<3,
+                CellStart = 1<<4,
+                CellMiddle = 1<<5,
+                CellEnd = 1<<6
+            };
+
             //! constructor
-            explicit Detail( const char* value = 0L )
-            { if( value ) _value = value; }
+            explicit Detail( const char* value = 0L ):
+                _value( value ),
+                _type( Null ),
+                _flags( 0 )
+            { if( value && value[0] ) parse( value ); }
+
+            //! type
+            Type type( void ) const
+            { return _type; }
+
+            //! cell flags
+            unsigned int flags( void ) const
+            { return _flags; }
 
             //! true when no valid value was passed
-            bool isNull( void ) const { return _value.empty(); }
-            bool is( const std::string value ) const
-            { return _value == value; }
+            bool isNull( void ) const { return _type == Null; }
+
+            //! generic comparison, for details that have no dedicated type
+            bool is( const char* value ) const
+            { return _value && !strcmp( _value, value ); }
 
-            bool isArrow( void ) const { return _value == "arrow"; }
-            bool isBar( void ) const { return _value == "bar"; }
-            bool isBase( void ) const { return _value == "base"; }
-            bool isButton( void ) const { return _value == "button"; }
+            bool isArrow( void ) const { return _type == Arrow; }
+            bool isBar( void ) const { return _type == Bar; }
+            bool isBase( void ) const { return _type == Base; }
+            bool isButton( void ) const { return _type == Button; }
 
             //! iconview
-            bool isIconViewItem( void ) const { return _value == "icon_view_item"; }
+            bool isIconViewItem( void ) const { return _type == IconViewItem; }
 
             //!@name treeview cells
             //@{
 
-            bool isCellEvenSorted( void ) const { return _value == "cell_even_sorted"; }
-            bool isCellEvenRuled( void ) const { return _value == "cell_even_ruled"; }
-            bool isCellOddSorted( void ) const { return _value == "cell_odd_sorted"; }
-            bool isCellOddRuled( void ) const { return _value == "cell_odd_ruled"; }
-            bool isCell( void ) const { return _value.find( "cell_" ) == 0; }
+            bool isCellEvenSorted( void ) const { return isCell() && _flags == (CellEven|CellSorted); }
+            bool isCellEvenRuled( void ) const { return isCell() && _flags == (CellEven|CellRuled); }
+            bool isCellOddSorted( void ) const { return isCell() && _flags == (CellOdd|CellSorted); }
+            bool isCellOddRuled( void ) const { return isCell() && _flags == (CellOdd|CellRuled); }
+            bool isCell( void ) const { return _type == Cell; }
 
-            bool isCellOdd( void ) const { return isCell() && _value.find( "_odd" ) != std::string::npos; }
-            bool isCellEven( void ) const { return isCell() && _value.find( "_even" ) != std::string::npos; }
+            bool isCellOdd( void ) const { return _flags & CellOdd; }
+            bool isCellEven( void ) const { return _flags & CellEven; }
 
-            bool isCellRuled( void ) const { return isCell() && _value.find( "_ruled" ) != std::string::npos; }
-            bool isCellStart( void ) const { return isCell() && _value.find( "_start" ) != std::string::npos; }
-            bool isCellEnd( void ) const { return isCell() && _value.find( "_end" ) != std::string::npos; }
-            bool isCellMiddle( void ) const { return isCell() && _value.find( "_middle" ) != std::string::npos; }
+            bool isCellRuled( void ) const { return _flags & CellRuled; }
+            bool isCellStart( void ) const { return _flags & CellStart; }
+            bool isCellEnd( void ) const { return _flags & CellEnd; }
+            bool isCellMiddle( void ) const { return _flags & CellMiddle; }
 
-            bool isCellRadio( void ) const { return _value == "cellradio"; }
+            bool isCellRadio( void ) const { return _type == CellRadio; }
             //@}
 
-            bool isDragAndDrop( void ) const { return _value == "dnd"; }
+            bool isDragAndDrop( void ) const { return _type == DragAndDrop; }
 
             //!@name scrollbars
             //@{
-            bool isHScrollBar( void ) const { return _value == "hscrollbar"; }
-            bool isVScrollBar( void ) const { return _value == "vscrollbar"; }
+            bool isHScrollBar( void ) const { return _type == HScrollBar; }
+            bool isVScrollBar( void ) const { return _type == VScrollBar; }
             bool isScrollBar( void ) const { return isVScrollBar() || isHScrollBar(); }
             //@}
 
             //!@name scales
             //@{
-            bool isHScale( void ) const { return _value == "hscale"; }
-            bool isVScale( void ) const { return _value == "vscale"; }
+            bool isHScale( void ) const { return _type == HScale; }
+            bool isVScale( void ) const { return _type == VScale; }
             bool isScale( void ) const { return isHScale() || isVScale(); }
             //@}
 
-            bool isCellCheck( void ) const { return _value == "cellcheck"; }
-            bool isCheck( void ) const { return _value == "check"; }
-            bool isCheckButton( void ) const { return _value == "checkbutton"; }
-            bool isDefaultButton( void ) const { return _value == "buttondefault"; }
-            bool isDockItem( void ) const { return _value == "dockitem"; }
-            bool isInfoBar( void ) const { return _value.find( "infobar" ) == 0; }
-            bool isEntry( void ) const { return _value == "entry"; }
-            bool isEntryBg( void ) const { return _value == "entry_bg"; }
-            bool isEntryProgress( void ) const { return _value == "entry-progress"; }
-            bool isEventBox( void ) const { return _value == "eventbox"; }
-            bool isExpander( void ) const { return _value == "expander"; }
-            bool isFrame( void ) const { return _value == "frame"; }
-            bool isHandleBox( void ) const { return _value == "handlebox" || _value == "handlebox_bin"; }
-            bool isMenu( void ) const { return _value == "menu"; }
-            bool isMenuBar( void ) const { return _value == "menubar"; }
-            bool isMenuItem( void ) const { return _value == "menuitem"; }
-            bool isMenuScrollArrow( void ) const { return _value == "menu_scroll_arrow_down" || _value == "menu_scroll_arrow_up"; }
-            bool isNotebook( void ) const { return _value == "notebook"; }
-            bool isOption( void ) const { return _value == "option"; }
-            bool isOptionMenu( void ) const { return _value == "optionmenu"; }
-            bool isOptionMenuTab( void ) const { return _value == "optionmenutab"; }
-            bool isPaned( void ) const { return _value == "paned"; }
-            bool isRadioButton( void ) const { return _value == "radiobutton"; }
-            bool isProgressBar( void) const { return _value == "progressbar"; }
+            bool isCellCheck( void ) const { return _type == CellCheck; }
+            bool isCheck( void ) const { return _type == Check; }
+            bool isCheckButton( void ) const { return _type == CheckButton; }
+            bool isDefaultButton( void ) const { return _type == DefaultButton; }
+            bool isDockItem( void ) const { return _type == DockItem; }
+            bool isInfoBar( void ) const { return _type == InfoBar; }
+            bool isEntry( void ) const { return _type == Entry; }
+            bool isEntryBg( void ) const { return _type == EntryBg; }
+            bool isEntryProgress( void ) const { return _type == EntryProgress; }
+            bool isEventBox( void ) const { return _type == EventBox; }
+            bool isExpander( void ) const { return _type == Expander; }
+            bool isFrame( void ) const { return _type == Frame; }
+            bool isHandleBox( void ) const { return _type == HandleBox || _type == HandleBoxBin; }
+            bool isMenu( void ) const { return _type == Menu; }
+            bool isMenuBar( void ) const { return _type == MenuBar; }
+            bool isMenuItem( void ) const { return _type == MenuItem; }
+            bool isMenuScrollArrow( void ) const { return _type == MenuScrollArrowDown || _type == MenuScrollArrowUp; }
+            bool isNotebook( void ) const { return _type == Notebook; }
+            bool isOption( void ) const { return _type == Option; }
+            bool isOptionMenu( void ) const { return _type == OptionMenu; }
+            bool isOptionMenuTab( void ) const { return _type == OptionMenuTab; }
+            bool isPaned( void ) const { return _type == Paned; }
+            bool isRadioButton( void ) const { return _type == RadioButton; }
+            bool isProgressBar( void) const { return _type == ProgressBar; }
 
             //!@name rulers
             //@{
-            bool isRuler( void ) const { return _value == "vruler" || _value == "hruler"; }
+            bool isRuler( void ) const { return _type == VRuler || _type == HRuler; }
             //@}
 
-            bool isScrolledWindow( void ) const { return _value == "scrolled_window"; }
-            bool isSlider( void ) const { return _value == "slider"; }
+            bool isScrolledWindow( void ) const { return _type == ScrolledWindow; }
+            bool isSlider( void ) const { return _type == Slider; }
 
             //!@name spinbuttons
             //@{
-            bool isSpinButton( void ) const { return _value == "spinbutton"; }
-            bool isSpinButtonUp( void ) const { return _value=="spinbutton_up"; }
-            bool isSpinButtonDown( void ) const { return _value=="spinbutton_down"; }
+            bool isSpinButton( void ) const { return _type == SpinButton; }
+            bool isSpinButtonUp( void ) const { return _type == SpinButtonUp; }
+            bool isSpinButtonDown( void ) const { return _type == SpinButtonDown; }
             bool isSpinButtonArrow( void ) const { return isSpinButtonUp() || isSpinButtonDown(); }
             //@}
 
-            bool isStepper( void ) const { return _value == "stepper"; }
+            bool isStepper( void ) const { return _type == Stepper; }
 
-            bool isTab( void ) const { return _value == "tab"; }
-            bool isTearOffMenuItem( void ) const { return _value == "tearoffmenuitem"; }
-            bool isToggleButton( void ) const { return _value == "togglebutton"; }
-            bool isToolBar( void ) const { return _value == "toolbar"; }
-            bool isTooltip( void ) const { return _value == "tooltip"; }
-            bool isTreeView( void ) const { return _value == "treeview"; }
+            bool isTab( void ) const { return _type == Tab; }
+            bool isTearOffMenuItem( void ) const { return _type == TearOffMenuItem; }
+            bool isToggleButton( void ) const { return _type == ToggleButton; }
+            bool isToolBar( void ) const { return _type == ToolBar; }
+            bool isTooltip( void ) const { return _type == Tooltip; }
+            bool isTreeView( void ) const { return _type == TreeView; }
 
             //!@name through
             //@{
-            bool isTroughFillLevel( void ) const { return _value == "trough-fill-level"; }
-            bool isTroughLower( void ) const { return _value == "trough-lower"; }
-            bool isTroughUpper( void ) const { return _value == "trough-upper"; }
-            bool isTrough( void ) const { return _value == "trough"; }
+            bool isTroughFillLevel( void ) const { return _type == TroughFillLevel; }
+            bool isTroughLower( void ) const { return _type == TroughLower; }
+            bool isTroughUpper( void ) const { return _type == TroughUpper; }
+            bool isTrough( void ) const { return _type == Trough; }
             bool isTroughAny( void ) const { return isTrough()||isTroughLower()||isTroughUpper(); }
             //@}
 
-            bool isViewport( void ) const { return _value == "viewport"; }
-            bool isViewportBin( void ) const { return _value == "viewportbin"; }
+            bool isViewport( void ) const { return _type == Viewport; }
+            bool isViewportBin( void ) const { return _type == ViewportBin; }
+
+            protected:
+
+            //! parse value into type and flags
+            void parse( const char* );
+
+            //! parse cell flags from value, past the "cell_" prefix
+            void parseCellFlags( const char* );
 
             private:
 
             //! value
-            std::string _value;
+            const char* _value;
+
+            //! type
+            Type _type;
+
+            //! cell flags
+            unsigned int _flags;
 
         };
 
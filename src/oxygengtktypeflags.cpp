@@ -0,0 +1,79 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygengtktypeflags.h"
+#include "config.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace Oxygen
+{
+
+    //____________________________________________________________________
+    GQuark Gtk::TypeFlags::_quark = 0;
+
+    //____________________________________________________________________
+    unsigned int Gtk::TypeFlags::compute( GType type )
+    {
+
+        unsigned int flags( Computed );
+        if( g_type_is_a( type, GTK_TYPE_WINDOW ) ) flags |= Window;
+        if( g_type_is_a( type, GTK_TYPE_NOTEBOOK ) ) flags |= Notebook;
+        if( g_type_is_a( type, GTK_TYPE_LABEL ) ) flags |= Label;
+        if( g_type_is_a( type, GTK_TYPE_BUTTON ) ) flags |= Button;
+
+        if(
+            g_type_is_a( type, GTK_TYPE_WINDOW ) ||
+            g_type_is_a( type, GTK_TYPE_VIEWPORT ) ||
+            g_type_is_a( type, GTK_TYPE_TOOLBAR ) ||
+            g_type_is_a( type, GTK_TYPE_MENU_BAR ) ||
+            g_type_is_a( type, GTK_TYPE_NOTEBOOK ) )
+        { flags |= WindowManagerWidget; }
+
+        if( isA( type, "SwtFixed" ) || isA( type, "GtkPizza" ) )
+        { flags |= InnerShadowBlackList; }
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::Gtk::TypeFlags::compute - " << g_type_name( type ) << " flags: " << ( flags & ~Computed ) << std::endl;
+        #endif
+
+        g_type_set_qdata( type, quark(), GUINT_TO_POINTER( flags ) );
+        return flags;
+
+    }
+
+    //____________________________________________________________________
+    bool Gtk::TypeFlags::isA( GType type, const char* typeName )
+    {
+        for( ; type; type = g_type_parent( type ) )
+        { if( !strcmp( g_type_name( type ), typeName ) ) return true; }
+
+        return false;
+    }
+
+    //____________________________________________________________________
+    GQuark Gtk::TypeFlags::quark( void )
+    {
+        if( !_quark ) _quark = g_quark_from_static_string( "oxygen-type-flags" );
+        return _quark;
+    }
+
+}
@@ -0,0 +1,102 @@
+#ifndef oxygengtktypeflags_h
+#define oxygengtktypeflags_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include <gtk/gtk.h>
+
+namespace Oxygen
+{
+
+    namespace Gtk
+    {
+
+        //! widget classification, computed once per GType
+        /*!
+        global emission hooks run for every widget of the application. They use these flags
+        to return early, with a single lookup, for widget types they never handle.
+        Flags are stored as GType qdata.
+        */
+        class TypeFlags
+        {
+
+            public:
+
+            //! flags
+            enum Flag
+            {
+                None = 0,
+
+                //! GtkWindow
+                Window = 1<<0,
+
+                //! GtkNotebook
+                Notebook = 1<<1,
+
+                //! GtkLabel
+                Label = 1<<2,
+
+                //! GtkButton
+                Button = 1<<3,
+
+                //! widgets registered to the window manager: windows, viewports, toolbars, menubars and notebooks
+                WindowManagerWidget = 1<<4,
+
+                //! widgets for which inner shadows are never installed
+                InnerShadowBlackList = 1<<5,
+
+                //! set once flags have been computed
+                Computed = 1<<30
+            };
+
+            //! flags for a given type
+            static unsigned int get( GType type )
+            {
+                const unsigned int flags( GPOINTER_TO_UINT( g_type_get_qdata( type, quark() ) ) );
+                return ( flags & Computed ) ? flags : compute( type );
+            }
+
+            //! true if widget type matches any of the flags
+            static bool test( GtkWidget* widget, unsigned int flags )
+            { return get( G_OBJECT_TYPE( widget ) ) & flags; }
+
+            protected:
+
+            //! compute and store flags for a given type
+            static unsigned int compute( GType );
+
+            //! true if type or one of its parents matches name
+            static bool isA( GType, const char* );
+
+            //! quark
+            static GQuark quark( void );
+
+            private:
+
+            //! quark
+            static GQuark _quark;
+
+        };
+
+    }
+
+}
+
+#endif
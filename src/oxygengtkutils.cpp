@@ -83,35 +83,35 @@ namespace Oxygen
         std::cerr << "Gtk::gtk_widget_is_applet(): " << Gtk::gtk_widget_path(widget) << std::endl;
         #endif
 
-        static const char* names[] =
+        static const TypeName names[] =
         {
-            "Panel",
-            "PanelWidget",
-            "PanelApplet",
-            "XfcePanelWindow",
-            0
+            TypeName( "Panel" ),
+            TypeName( "PanelWidget" ),
+            TypeName( "PanelApplet" ),
+            TypeName( "XfcePanelWindow" ),
+            TypeName( 0L )
         };
 
         // check widget name
-        std::string name( G_OBJECT_TYPE_NAME( widget ) );
-        for( unsigned int i = 0; names[i]; ++i )
-        { if( g_object_is_a( G_OBJECT( widget ), names[i] ) || name.find( names[i] ) == 0  ) return true; }
+        const char* name( G_OBJECT_TYPE_NAME( widget ) );
+        for( unsigned int i = 0; names[i].name(); ++i )
+        { if( g_object_is_a( G_OBJECT( widget ), names[i] ) || g_str_has_prefix( name, names[i].name() ) ) return true; }
 
         // also check parent
         if( GtkWidget* parent = gtk_widget_get_parent( widget ) )
         {
             name = G_OBJECT_TYPE_NAME( parent );
-            for( unsigned int i = 0; names[i]; ++i )
-            { if( g_object_is_a( G_OBJECT( parent ), names[i] ) || name.find( names[i] ) == 0 ) return true; }
+            for( unsigned int i = 0; names[i].name(); ++i )
+            { if( g_object_is_a( G_OBJECT( parent ), names[i] ) || g_str_has_prefix( name, names[i].name() ) ) return true; }
 
         }
 
         // also check first widget path element (needed for xfce panel)
         std::string widgetPath=Gtk::gtk_widget_path(widget);
         {
-            for( unsigned int i = 0; names[i]; ++i )
+            for( unsigned int i = 0; names[i].name(); ++i )
             {
-                if( widgetPath.find(names[i]) != std::string::npos )
+                if( widgetPath.find(names[i].name()) != std::string::npos )
                     return true;
             }
         }
@@ -199,14 +199,14 @@ namespace Oxygen
     }
 
     //________________________________________________________
-    bool Gtk::g_object_is_a( const GObject* object, const std::string& typeName )
+    bool Gtk::g_object_is_a( const GObject* object, const char* typeName )
     {
 
         if( object )
         {
-            const GType tmp( g_type_from_name( typeName.c_str() ) );
+            const GType tmp( g_type_from_name( typeName ) );
             if( tmp )
-            { return g_type_check_instance_is_a( (GTypeInstance*) object, tmp ); }
+            { return g_type_is_a( G_OBJECT_TYPE( object ), tmp ); }
         }
 
         return false;
@@ -469,45 +469,6 @@ namespace Oxygen
         const GtkAllocation allocation( gtk_widget_get_allocation( tabLabel ) );
         return Gtk::gdk_rectangle_contains( &allocation, x, y );
 
-    }
-
-     //________________________________________________________
-    int Gtk::gtk_notebook_find_tab( GtkWidget* widget, int x, int y )
-    {
-
-        if( !GTK_IS_NOTEBOOK( widget ) ) return -1;
-
-        // cast to notebook and check against number of pages
-        GtkNotebook* notebook( GTK_NOTEBOOK( widget ) );
-        int tab(-1);
-        int minDistance( -1 );
-        for( int i = gtk_notebook_find_first_tab( widget ); i <  gtk_notebook_get_n_pages( notebook ); ++i )
-        {
-
-            // retrieve page and tab label
-            GtkWidget* page( gtk_notebook_get_nth_page( notebook, i ) );
-            if( !page ) continue;
-
-            // get label
-            GtkWidget* tabLabel( gtk_notebook_get_tab_label( notebook, page ) );
-            if(!tabLabel) continue;
-
-            // get allocted size and compare to position
-            const GtkAllocation allocation( gtk_widget_get_allocation( tabLabel ) );
-
-            // get manhattan length
-            const int distance = int(
-                std::abs( double( allocation.x + allocation.width/2 - x ) ) +
-                std::abs( double( allocation.y + allocation.height/2 - y ) ) );
-            if( minDistance < 0 || distance < minDistance )
-            {
-                tab = i;
-                minDistance = distance;
-            }
-        }
-
-        return tab;
-
     }
 
     //________________________________________________________
@@ -700,7 +661,8 @@ namespace Oxygen
     {
 
         // FMIconView (from nautilus) always get sunken
-        if( g_object_is_a( G_OBJECT( widget ), "FMIconView" ) ) return true;
+        static const TypeName iconViewType( "FMIconView" );
+        if( g_object_is_a( G_OBJECT( widget ), iconViewType ) ) return true;
 
         // other checks require widget to be of type GtkBin
         if( !GTK_IS_BIN( widget ) ) return false;
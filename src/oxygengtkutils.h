@@ -224,8 +224,57 @@ namespace Oxygen
         //! returns true if window is a base window that do not need painting
         bool gdk_window_nobackground( GdkWindow* );
 
+        //! type name, resolved to a GType once the type gets registered
+        /*!
+        meant to be used as a static variable at the call site, so that type checks
+        use g_type_is_a on integers rather than resolving the type name each time.
+        */
+        class TypeName
+        {
+
+            public:
+
+            //! constructor
+            explicit TypeName( const char* name ):
+                _name( name ),
+                _type( 0 )
+            {}
+
+            //! name
+            const char* name( void ) const
+            { return _name; }
+
+            //! type. Returns 0 as long as type is not registered
+            GType type( void ) const
+            {
+                if( !_type ) _type = g_type_from_name( _name );
+                return _type;
+            }
+
+            //! true if object match type
+            bool matches( const GObject* object ) const
+            {
+                if( !object ) return false;
+                const GType type( this->type() );
+                return type && g_type_is_a( G_OBJECT_TYPE( object ), type );
+            }
+
+            private:
+
+            //! name
+            const char* _name;
+
+            //! resolved type
+            mutable GType _type;
+
+        };
+
         //! true if object match a given type
-        bool g_object_is_a( const GObject*, const std::string& );
+        bool g_object_is_a( const GObject*, const char* );
+
+        //! true if object match a given type
+        inline bool g_object_is_a( const GObject* object, const TypeName& typeName )
+        { return typeName.matches( object ); }
 
         //! trigger area update using GdkRectangle
         inline void gtk_widget_queue_draw( GtkWidget* widget, const GdkRectangle* rect = 0L )
@@ -395,9 +444,6 @@ namespace Oxygen
         //* this should move to OxygenTabWidgetData
         bool gtk_notebook_tab_contains( GtkWidget*, int tab, int x, int y );
 
-        //! returns tab matching position or -1 if none
-        int gtk_notebook_find_tab( GtkWidget*, int x, int y );
-
         //! returns index of first visible tab
         int gtk_notebook_find_first_tab( GtkWidget* );
 
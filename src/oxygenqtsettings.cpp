@@ -25,8 +25,9 @@
 #include "oxygenfontinfo.h"
 #include "oxygengtkicons.h"
 #include "oxygengtkrc.h"
-#include "oxygenshadowhelper.h"
 #include "oxygentimeline.h"
+#include "oxygentimelineserver.h"
+#include "oxygenx11atoms.h"
 #include "config.h"
 
 #include <glib.h>
@@ -42,11 +43,6 @@
 #include <iostream>
 #include <sstream>
 
-#ifdef GDK_WINDOWING_X11
-#include <gdk/gdkx.h>
-#include <X11/Xatom.h>
-#endif
-
 namespace Oxygen
 {
 
@@ -137,7 +133,12 @@ namespace Oxygen
 
         // support for wm shadows
         {
-            const bool wmShadowsSupported( isAtomSupported( ShadowHelper::netWMShadowAtomName ) );
+            #ifdef GDK_WINDOWING_X11
+            const bool wmShadowsSupported( X11Atoms::instance().isSupported( X11Atoms::NetWMShadow ) );
+            #else
+            const bool wmShadowsSupported( false );
+            #endif
+
             if( wmShadowsSupported != _wmShadowsSupported )
             {
                 _wmShadowsSupported = wmShadowsSupported;
@@ -261,73 +262,6 @@ namespace Oxygen
 
     }
 
-    //_______________________________________________________
-    bool QtSettings::isAtomSupported( const std::string& atomNameQuery ) const
-    {
-
-        // create atom
-        #ifdef GDK_WINDOWING_X11
-
-        // get screen and check
-        GdkScreen* screen = gdk_screen_get_default();
-        if( !screen ) return false;
-
-        // get display and check
-        GdkDisplay *gdkDisplay( gdk_screen_get_display( screen ) );
-        Display* display( GDK_DISPLAY_XDISPLAY( gdkDisplay ) );
-
-        // create atom
-        Atom netSupportedAtom( XInternAtom( display, "_NET_SUPPORTED", False) );
-        if( !netSupportedAtom ) return false;
-
-        // root window
-        Window root( GDK_WINDOW_XID( gdk_screen_get_root_window( screen ) ) );
-        if( !root ) return false;
-
-        Atom type;
-        int format;
-        unsigned char *data;
-        unsigned long count;
-        unsigned long after;
-        int length = 32768;
-
-        while( true )
-        {
-
-            // get atom property on root window
-            // length is incremented until after is zero
-            if( XGetWindowProperty(
-                display, root,
-                netSupportedAtom, 0l, length,
-                false, XA_ATOM, &type,
-                &format, &count, &after, &data) != Success ) return false;
-
-            if( after == 0 ) break;
-
-            // free data, increase length
-            XFree( data );
-            length *= 2;
-            continue;
-
-        }
-
-        Atom* atoms = reinterpret_cast<Atom*>( data );
-        bool found( false );
-        for( unsigned long i = 0; i<count && !found; i++ )
-        {
-            char* atomName = XGetAtomName( display, atoms[i]);
-            if( strcmp( atomName, atomNameQuery.c_str() ) == 0 ) found = true;
-            XFree( atomName );
-        }
-
-        return found;
-
-        #else
-        return false;
-        #endif
-
-    }
-
     //_________________________________________________________
     bool QtSettings::loadOxygen( void )
     {
@@ -1119,6 +1053,7 @@ namespace Oxygen
 
         // animation steps
         TimeLine::setSteps( _oxygen.getOption( "[Style]", "AnimationSteps" ).toVariant<int>( 10 ) );
+        TimeLineServer::instance().setTargetFrameRate( _oxygen.getOption( "[Style]", "AnimationsFrameRate" ).toVariant<int>( 50 ) );
 
         // widget explorer
         _widgetExplorerEnabled =
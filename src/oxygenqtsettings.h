@@ -372,9 +372,6 @@ namespace Oxygen
         //! read output from a command - replacement for not always working g_spawn_command_line_sync()
         bool runCommand( const std::string& command, char*& result ) const;
 
-        //! returns true if a given atom is supported
-        bool isAtomSupported( const std::string& ) const;
-
         //! kdeglobals settings
         /*! returns true if changed */
         bool loadKdeGlobals( void );
@@ -0,0 +1,69 @@
+#ifndef oxygenregioncache_h
+#define oxygenregioncache_h
+
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or( at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygencache.h"
+
+#include <gdk/gdk.h>
+
+namespace Oxygen
+{
+
+    //! cache of GdkRegion, owned by the cache
+    template< typename T>
+    class RegionCache: public Cache<T, GdkRegion*>
+    {
+
+        public:
+
+        //! constructor
+        RegionCache( size_t size = 100 ):
+            Cache<T, GdkRegion*>( size, 0L )
+        {}
+
+        //! destructor
+        /*! regions must be destroyed here, since erase is not virtual anymore in base class destructor */
+        virtual ~RegionCache( void )
+        { Cache<T, GdkRegion*>::clear(); }
+
+        protected:
+
+        //! destroy region
+        virtual void erase( GdkRegion*& region )
+        {
+            if( region ) gdk_region_destroy( region );
+            region = 0L;
+        }
+
+        private:
+
+        //! copy constructor is private, since regions are owned
+        RegionCache( const RegionCache& );
+
+        //! assignment operator is private, since regions are owned
+        RegionCache& operator = ( const RegionCache& );
+
+    };
+
+}
+
+#endif
@@ -22,9 +22,11 @@
 #include "oxygencairoutils.h"
 #include "config.h"
 #include "oxygengtkutils.h"
+#include "oxygengtktypeflags.h"
 #include "oxygenmetrics.h"
 #include "oxygenrgba.h"
 #include "oxygenshadowhelper.h"
+#include "oxygenx11atoms.h"
 
 #include "config.h"
 
@@ -33,25 +35,53 @@
 #include <cairo/cairo.h>
 
 #ifdef GDK_WINDOWING_X11
-#include <cairo/cairo-xlib.h>
 #include <gdk/gdkx.h>
 #include <X11/Xatom.h>
+#include <X11/Xutil.h>
+
+#if HAVE_XSHM
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <X11/extensions/XShm.h>
+#endif
+
 #endif
 
 namespace Oxygen
 {
 
-    const char* const ShadowHelper::netWMShadowAtomName( "_KDE_NET_WM_SHADOW" );
+    //______________________________________________
+    //! combine value into hash
+    static guint32 hashValue( guint32 seed, guint32 value )
+    { return ( seed ^ value )*16777619U; }
+
+    //______________________________________________
+    //! combine shadow configuration into hash
+    static guint32 hashConfiguration( guint32 seed, const ShadowConfiguration& configuration )
+    {
+        seed = hashValue( seed, configuration.isEnabled() );
+        seed = hashValue( seed, guint32( configuration.shadowSize()*100 ) );
+        seed = hashValue( seed, guint32( configuration.horizontalOffset()*100 ) );
+        seed = hashValue( seed, guint32( configuration.verticalOffset()*100 ) );
+        seed = hashValue( seed, configuration.innerColor().toInt() );
+        seed = hashValue( seed, configuration.outerColor().toInt() );
+        return seed;
+    }
 
     //______________________________________________
     ShadowHelper::ShadowHelper( void ):
         _supported( false ),
         _size(0),
+        _pixmapKey(0),
         _hooksInitialized( false )
     {
 
         #ifdef GDK_WINDOWING_X11
         _atom = None;
+        _sharedPixmapsAtom = None;
+        _sharedPixmapsOwner = None;
+        _ownsPixmaps = false;
+        _filterInstalled = false;
         #endif
 
         #if OXYGEN_DEBUG
@@ -71,6 +101,11 @@ namespace Oxygen
 
         reset();
         _realizeHook.disconnect();
+
+        #ifdef GDK_WINDOWING_X11
+        if( _filterInstalled )
+        { gdk_window_remove_filter( 0L, (GdkFilterFunc)sharedPixmapsFilter, this ); }
+        #endif
     }
 
     //______________________________________________
@@ -87,13 +122,31 @@ namespace Oxygen
 
         Display* display( GDK_DISPLAY_XDISPLAY( gdk_screen_get_display( screen ) ) );
 
-        // round pixmaps
-        for( PixmapList::const_iterator iter = _roundPixmaps.begin(); iter != _roundPixmaps.end(); ++iter )
-        { XFreePixmap(display, *iter); }
+        if( _ownsPixmaps )
+        {
+
+            // destroy owner window first, so that other processes stop using the pixmaps
+            if( _sharedPixmapsOwner ) XDestroyWindow( display, _sharedPixmapsOwner );
+
+            // round pixmaps
+            for( PixmapList::const_iterator iter = _roundPixmaps.begin(); iter != _roundPixmaps.end(); ++iter )
+            { XFreePixmap(display, *iter); }
 
-        // square pixmaps
-        for( PixmapList::const_iterator iter = _squarePixmaps.begin(); iter != _squarePixmaps.end(); ++iter )
-        { XFreePixmap(display, *iter); }
+            // square pixmaps
+            for( PixmapList::const_iterator iter = _squarePixmaps.begin(); iter != _squarePixmaps.end(); ++iter )
+            { XFreePixmap(display, *iter); }
+
+        } else if( _sharedPixmapsOwner ) {
+
+            // pixmaps belong to another process. Stop tracking its owner window
+            gdk_error_trap_push();
+            XSelectInput( display, _sharedPixmapsOwner, NoEventMask );
+            gdk_error_trap_pop();
+
+        }
+
+        _sharedPixmapsOwner = None;
+        _ownsPixmaps = false;
         #endif
 
         // clear arrays
@@ -142,9 +195,16 @@ namespace Oxygen
         key.hasBottomBorder = false;
         _squareTiles = shadow.tileSet( color, key );
 
+        // identify shadow configuration, to share pixmaps with other processes
+        _pixmapKey = hashValue( 2166136261U, color.toInt() );
+        _pixmapKey = hashValue( _pixmapKey, _size );
+        _pixmapKey = hashValue( _pixmapKey, ShadowOpacity );
+        _pixmapKey = hashConfiguration( _pixmapKey, shadow.activeShadowConfiguration() );
+        _pixmapKey = hashConfiguration( _pixmapKey, shadow.inactiveShadowConfiguration() );
+
         // re-install shadows for all windowId
         for( WidgetMap::const_iterator iter = _widgets.begin(); iter != _widgets.end(); ++iter )
-        { installX11Shadows( iter->first ); }
+        { scheduleX11Shadows( iter->first ); }
 
     }
 
@@ -159,19 +219,29 @@ namespace Oxygen
         if( !( widget && GTK_IS_WINDOW( widget ) ) ) return false;
 
         // make sure that widget is not already registered
-        if( _widgets.find( widget ) != _widgets.end() ) return false;
+        /*
+        widget might have been re-realized with a new X11 window, so shadows are installed again.
+        Nothing is written if the window already has the same shadow property.
+        Installation is not deferred here, since the window gets mapped right after being realized,
+        and the compositor would otherwise show it without shadow
+        */
+        if( _widgets.find( widget ) != _widgets.end() )
+        {
+            _pendingWidgets.erase( widget );
+            installX11Shadows( widget );
+            return false;
+        }
 
         // check if window is accepted
         if( !acceptWidget( widget ) ) return false;
 
-        // try install shadows
-        installX11Shadows( widget );
-
-        // register in map and returns success
+        // register in map
         WidgetData data;
         data._destroyId.connect( G_OBJECT( widget ), "destroy", G_CALLBACK( destroyNotifyEvent ), this );
         _widgets.insert( std::make_pair( widget, data ) );
 
+        // install shadows before window gets mapped, and returns success
+        installX11Shadows( widget );
         return true;
 
     }
@@ -188,6 +258,7 @@ namespace Oxygen
 
         // remove from map
         _widgets.erase( iter );
+        _pendingWidgets.erase( widget );
     }
 
     //______________________________________________
@@ -238,134 +309,424 @@ namespace Oxygen
         #endif
 
         #ifdef GDK_WINDOWING_X11
-        // create atom
+        // get atom
         if( !_atom )
         {
 
-            // get screen and check
-            GdkScreen* screen = gdk_screen_get_default();
-            if( !screen )
+            _atom = X11Atoms::instance().atom( X11Atoms::NetWMShadow );
+            if( !_atom )
             {
 
                 #if OXYGEN_DEBUG
-                std::cerr << "ShadowHelper::createPixmapHandles - screen is NULL" << std::endl;
+                std::cerr << "ShadowHelper::createPixmapHandles - unable to get shadow atom" << std::endl;
                 #endif
 
                 return;
             }
 
-            // get display and check
-            Display* display( GDK_DISPLAY_XDISPLAY( gdk_screen_get_display( screen ) ) );
-            if( !display )
-            {
-
-                #if OXYGEN_DEBUG
-                std::cerr << "ShadowHelper::createPixmapHandles - display is NULL" << std::endl;
-                #endif
-
-                return;
-            }
-
-           _atom = XInternAtom( display, netWMShadowAtomName, False);
         }
 
         // make sure size is valid
         if( _size <= 0 ) return;
 
-        // opacity
-        const int shadowOpacity = 150;
+        // make sure pixmaps are not already initialized
+        if( !( _roundPixmaps.empty() && _squarePixmaps.empty() ) ) return;
 
-        if( _roundPixmaps.empty() || _squarePixmaps.empty() )
+        // get screen, display, visual and check
+        // no need to check screen and display, since was already done for ATOM
+        GdkScreen* screen = gdk_screen_get_default();
+        if( !gdk_screen_get_rgba_visual( screen ) )
         {
-            // get screen, display, visual and check
-            // no need to check screen and display, since was already done for ATOM
-            GdkScreen* screen = gdk_screen_get_default();
-            if( !gdk_screen_get_rgba_visual( screen ) )
-            {
 
-                #if OXYGEN_DEBUG
-                std::cerr << "ShadowHelper::createPixmapHandles - no valid RGBA visual found." << std::endl;
-                #endif
+            #if OXYGEN_DEBUG
+            std::cerr << "ShadowHelper::createPixmapHandles - no valid RGBA visual found." << std::endl;
+            #endif
 
-                return;
+            return;
 
-            }
         }
 
-        // make sure pixmaps are not already initialized
-        if( _roundPixmaps.empty() )
+        // use pixmaps created by another process, if any
+        if( findSharedPixmaps() ) return;
+
+        // tiles order, as expected by _KDE_NET_WM_SHADOW
+        static const unsigned int tiles[numPixmaps] = { 1, 2, 5, 8, 7, 6, 3, 0 };
+
+        // render all tiles client side, with opacity premultiplied
+        SurfaceList images;
+        for( int i = 0; i < numPixmaps; ++i )
+        { images.push_back( createImage( _roundTiles.surface( tiles[i] ), ShadowOpacity ) ); }
+
+        for( int i = 0; i < numPixmaps; ++i )
+        { images.push_back( createImage( _squareTiles.surface( tiles[i] ), ShadowOpacity ) ); }
+
+        // upload
+        const PixmapList pixmaps( createPixmaps( images ) );
+        if( pixmaps.size() != 2*numPixmaps ) return;
+        _roundPixmaps.assign( pixmaps.begin(), pixmaps.begin() + numPixmaps );
+        _squarePixmaps.assign( pixmaps.begin() + numPixmaps, pixmaps.end() );
+
+        // advertise pixmaps to other processes
+        _ownsPixmaps = true;
+        publishPixmaps();
+
+        #endif
+
+    }
+
+    #ifdef GDK_WINDOWING_X11
+    //______________________________________________
+    bool ShadowHelper::findSharedPixmaps( void )
+    {
+
+        if( !_sharedPixmapsAtom ) _sharedPixmapsAtom = X11Atoms::instance().atom( X11Atoms::ShadowPixmaps );
+        if( !_sharedPixmapsAtom ) return false;
+
+        GdkScreen* screen = gdk_screen_get_default();
+        Display* display( GDK_DISPLAY_XDISPLAY( gdk_screen_get_display( screen ) ) );
+        Window root( GDK_WINDOW_XID( gdk_screen_get_root_window( screen ) ) );
+
+        const WindowList owners( sharedPixmapsOwners( display, root ) );
+        for( WindowList::const_iterator iter = owners.begin(); iter != owners.end(); ++iter )
         {
 
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 1 ), shadowOpacity ) );
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 2 ), shadowOpacity ) );
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 5 ), shadowOpacity ) );
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 8 ), shadowOpacity ) );
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 7 ), shadowOpacity ) );
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 6 ), shadowOpacity ) );
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 3 ), shadowOpacity ) );
-            _roundPixmaps.push_back( createPixmap( _roundTiles.surface( 0 ), shadowOpacity ) );
+            // read pixmaps advertised on owner window. Window might already be destroyed
+            Atom type;
+            int format;
+            unsigned long count;
+            unsigned long after;
+            unsigned char* data( 0L );
+
+            gdk_error_trap_push();
+            const bool success( XGetWindowProperty(
+                display, *iter, _sharedPixmapsAtom, 0, 1+2*numPixmaps, False,
+                XA_CARDINAL, &type, &format, &count, &after, &data ) == Success );
+            if( gdk_error_trap_pop() || !success ) continue;
+            if( !data ) continue;
+
+            // check format and shadow configuration
+            PixmapList roundPixmaps;
+            PixmapList squarePixmaps;
+            const unsigned long* values( reinterpret_cast<const unsigned long*>( data ) );
+            if( format == 32 && count == 1+2*numPixmaps && values[0] == _pixmapKey )
+            {
+                roundPixmaps.assign( values + 1, values + 1 + numPixmaps );
+                squarePixmaps.assign( values + 1 + numPixmaps, values + 1 + 2*numPixmaps );
+            }
+
+            XFree( data );
+            if( roundPixmaps.empty() ) continue;
+
+            // track owner destruction
+            if( !_filterInstalled )
+            {
+                gdk_window_add_filter( 0L, (GdkFilterFunc)sharedPixmapsFilter, this );
+                _filterInstalled = true;
+            }
+
+            // check owner again after selecting input, in case it was destroyed in between
+            XWindowAttributes attributes;
+            gdk_error_trap_push();
+            XSelectInput( display, *iter, StructureNotifyMask );
+            XGetWindowAttributes( display, *iter, &attributes );
+            if( gdk_error_trap_pop() ) continue;
+
+            #if OXYGEN_DEBUG
+            std::cerr << "Oxygen::ShadowHelper::findSharedPixmaps - using pixmaps from window: " << *iter << std::endl;
+            #endif
+
+            _roundPixmaps = roundPixmaps;
+            _squarePixmaps = squarePixmaps;
+            _sharedPixmapsOwner = *iter;
+            _ownsPixmaps = false;
+            return true;
 
         }
 
-        if( _squarePixmaps.empty() )
+        return false;
+
+    }
+
+    //______________________________________________
+    void ShadowHelper::publishPixmaps( void )
+    {
+
+        if( !_sharedPixmapsAtom ) return;
+
+        GdkScreen* screen = gdk_screen_get_default();
+        Display* display( GDK_DISPLAY_XDISPLAY( gdk_screen_get_display( screen ) ) );
+        Window root( GDK_WINDOW_XID( gdk_screen_get_root_window( screen ) ) );
+
+        // create unmapped window to advertise pixmaps.
+        XSetWindowAttributes attributes;
+        attributes.override_redirect = True;
+        _sharedPixmapsOwner = XCreateWindow(
+            display, root, -1, -1, 1, 1, 0, 0, InputOnly, CopyFromParent,
+            CWOverrideRedirect, &attributes );
+
+        // store configuration key and pixmaps
+        std::vector<unsigned long> data;
+        data.push_back( _pixmapKey );
+        data.insert( data.end(), _roundPixmaps.begin(), _roundPixmaps.end() );
+        data.insert( data.end(), _squarePixmaps.begin(), _squarePixmaps.end() );
+        XChangeProperty(
+            display, _sharedPixmapsOwner, _sharedPixmapsAtom, XA_CARDINAL, 32, PropModeReplace,
+            reinterpret_cast<const unsigned char *>(&data[0]), data.size() );
+
+        // update owners list on root window, removing windows from processes that have exited
+        WindowList owners;
+        const WindowList oldOwners( sharedPixmapsOwners( display, root ) );
+        for( WindowList::const_iterator iter = oldOwners.begin(); iter != oldOwners.end(); ++iter )
         {
+            XWindowAttributes windowAttributes;
+            gdk_error_trap_push();
+            XGetWindowAttributes( display, *iter, &windowAttributes );
+            if( !gdk_error_trap_pop() ) owners.push_back( *iter );
+        }
+
+        // keep most recent owners only
+        if( owners.size() >= MaxSharedPixmapSets )
+        { owners.erase( owners.begin(), owners.begin() + ( owners.size() - MaxSharedPixmapSets + 1 ) ); }
+
+        owners.push_back( _sharedPixmapsOwner );
+        XChangeProperty(
+            display, root, _sharedPixmapsAtom, XA_WINDOW, 32, PropModeReplace,
+            reinterpret_cast<const unsigned char *>(&owners[0]), owners.size() );
 
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 1 ), shadowOpacity ) );
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 2 ), shadowOpacity ) );
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 5 ), shadowOpacity ) );
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 8 ), shadowOpacity ) );
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 7 ), shadowOpacity ) );
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 6 ), shadowOpacity ) );
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 3 ), shadowOpacity ) );
-            _squarePixmaps.push_back( createPixmap( _squareTiles.surface( 0 ), shadowOpacity ) );
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::ShadowHelper::publishPixmaps - window: " << _sharedPixmapsOwner << std::endl;
+        #endif
+
+    }
+
+    //______________________________________________
+    ShadowHelper::WindowList ShadowHelper::sharedPixmapsOwners( Display* display, Window root ) const
+    {
 
+        WindowList out;
+
+        Atom type;
+        int format;
+        unsigned long count;
+        unsigned long after;
+        unsigned char* data( 0L );
+
+        if( XGetWindowProperty(
+            display, root, _sharedPixmapsAtom, 0, MaxSharedPixmapSets, False,
+            XA_WINDOW, &type, &format, &count, &after, &data ) != Success ) return out;
+
+        if( !data ) return out;
+        if( format == 32 )
+        {
+            const Window* windows( reinterpret_cast<const Window*>( data ) );
+            out.assign( windows, windows + count );
         }
 
+        XFree( data );
+        return out;
+
+    }
+
+    //______________________________________________
+    void ShadowHelper::sharedPixmapsDestroyed( void )
+    {
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::ShadowHelper::sharedPixmapsDestroyed - window: " << _sharedPixmapsOwner << std::endl;
         #endif
 
+        // pixmaps were destroyed together with their owner. Nothing to free
+        _roundPixmaps.clear();
+        _squarePixmaps.clear();
+        _sharedPixmapsOwner = None;
+        _ownsPixmaps = false;
+
+        // re-install shadows, using pixmaps from another process, or new ones
+        for( WidgetMap::const_iterator iter = _widgets.begin(); iter != _widgets.end(); ++iter )
+        { scheduleX11Shadows( iter->first ); }
+
     }
 
     //______________________________________________
-    #ifdef GDK_WINDOWING_X11
-    Pixmap ShadowHelper::createPixmap( const Cairo::Surface& surface, int opacity ) const
+    GdkFilterReturn ShadowHelper::sharedPixmapsFilter( GdkXEvent* gdkXEvent, GdkEvent*, gpointer pointer )
+    {
+
+        ShadowHelper& helper( *static_cast<ShadowHelper*>( pointer ) );
+        if( helper._ownsPixmaps || !helper._sharedPixmapsOwner ) return GDK_FILTER_CONTINUE;
+
+        const XEvent* xEvent( static_cast<XEvent*>( gdkXEvent ) );
+        if( xEvent->type == DestroyNotify && xEvent->xdestroywindow.window == helper._sharedPixmapsOwner )
+        { helper.sharedPixmapsDestroyed(); }
+
+        return GDK_FILTER_CONTINUE;
+
+    }
+
+    //______________________________________________
+    ShadowHelper::PixmapList ShadowHelper::createPixmaps( const SurfaceList& images ) const
     {
-        assert( surface.isValid() );
-        int width(0);
-        int height(0);
-        cairo_surface_get_size( surface, width, height );
+
+        PixmapList pixmaps;
+        if( images.empty() ) return pixmaps;
 
         GdkScreen* screen = gdk_screen_get_default();
         Display* display( GDK_DISPLAY_XDISPLAY( gdk_screen_get_display( screen ) ) );
         Window root( GDK_WINDOW_XID( gdk_screen_get_root_window( screen ) ) );
-        Pixmap pixmap = XCreatePixmap( display, root, width, height, 32 );
+        Visual* visual( GDK_VISUAL_XVISUAL( gdk_screen_get_rgba_visual( screen ) ) );
 
-        // create surface for pixmap
+        for( SurfaceList::const_iterator iter = images.begin(); iter != images.end(); ++iter )
         {
-            Cairo::Surface dest( cairo_xlib_surface_create( display, pixmap, GDK_VISUAL_XVISUAL( gdk_screen_get_rgba_visual( screen ) ), width, height ) );
-            Cairo::Context context( dest );
-            cairo_set_operator( context, CAIRO_OPERATOR_SOURCE );
+            pixmaps.push_back( XCreatePixmap( display, root,
+                cairo_image_surface_get_width( *iter ),
+                cairo_image_surface_get_height( *iter ), 32 ) );
+        }
 
-            cairo_rectangle( context, 0, 0, width, height );
-            cairo_set_source_surface( context, surface, 0, 0 );
-            cairo_fill( context );
+        // all pixmaps have the same depth, and can share the same graphics context
+        GC gc( XCreateGC( display, pixmaps.front(), 0, 0L ) );
+
+        #if HAVE_XSHM
+        if( !putImagesShm( display, visual, gc, pixmaps, images ) )
+        #endif
+        { putImages( display, visual, gc, pixmaps, images ); }
 
-            if( opacity < 255 )
+        XFreeGC( display, gc );
+        return pixmaps;
+
+    }
+
+    //______________________________________________
+    void ShadowHelper::putImages( Display* display, Visual* visual, GC gc, const PixmapList& pixmaps, const SurfaceList& images ) const
+    {
+
+        for( size_t i = 0; i < images.size(); ++i )
+        {
+
+            cairo_surface_t* image( images[i] );
+            const int width( cairo_image_surface_get_width( image ) );
+            const int height( cairo_image_surface_get_height( image ) );
+
+            XImage* xImage( XCreateImage(
+                display, visual, 32, ZPixmap, 0,
+                reinterpret_cast<char*>( cairo_image_surface_get_data( image ) ),
+                width, height, 32, cairo_image_surface_get_stride( image ) ) );
+            if( !xImage ) continue;
+
+            // cairo data use native byte order. Xlib converts them if server differs
+            xImage->byte_order = ( G_BYTE_ORDER == G_LITTLE_ENDIAN ) ? LSBFirst:MSBFirst;
+            XInitImage( xImage );
+
+            XPutImage( display, pixmaps[i], gc, xImage, 0, 0, 0, 0, width, height );
+
+            // data belong to the cairo surface
+            xImage->data = 0L;
+            XDestroyImage( xImage );
+
+        }
+
+    }
+
+    #if HAVE_XSHM
+    //______________________________________________
+    bool ShadowHelper::putImagesShm( Display* display, Visual* visual, GC gc, const PixmapList& pixmaps, const SurfaceList& images ) const
+    {
+
+        // shared memory is only usable for local displays, with native byte order
+        if( !XShmQueryExtension( display ) ) return false;
+        if( ImageByteOrder( display ) != ( ( G_BYTE_ORDER == G_LITTLE_ENDIAN ) ? LSBFirst:MSBFirst ) ) return false;
+
+        // single segment for all images
+        size_t size( 0 );
+        for( SurfaceList::const_iterator iter = images.begin(); iter != images.end(); ++iter )
+        { size += 4*cairo_image_surface_get_width( *iter )*cairo_image_surface_get_height( *iter ); }
+
+        XShmSegmentInfo info;
+        info.shmid = shmget( IPC_PRIVATE, size, IPC_CREAT|0600 );
+        if( info.shmid < 0 ) return false;
+
+        info.shmaddr = static_cast<char*>( shmat( info.shmid, 0L, 0 ) );
+        if( info.shmaddr == reinterpret_cast<char*>( -1 ) )
+        {
+            shmctl( info.shmid, IPC_RMID, 0L );
+            return false;
+        }
+
+        info.readOnly = True;
+
+        // attach segment. This fails for remote displays
+        gdk_error_trap_push();
+        XShmAttach( display, &info );
+        XSync( display, False );
+        const bool attached( !gdk_error_trap_pop() );
+
+        // segment is destroyed once detached by both client and server
+        shmctl( info.shmid, IPC_RMID, 0L );
+
+        if( attached )
+        {
+
+            char* data( info.shmaddr );
+            for( size_t i = 0; i < images.size(); ++i )
             {
 
-                cairo_set_operator( context, CAIRO_OPERATOR_DEST_IN );
-                cairo_set_source( context, ColorUtils::Rgba( 0, 0, 0, double(opacity)/255 ) );
-                cairo_rectangle( context, 0, 0, width, height );
-                cairo_fill( context );
+                cairo_surface_t* image( images[i] );
+                const int width( cairo_image_surface_get_width( image ) );
+                const int height( cairo_image_surface_get_height( image ) );
+                const int stride( cairo_image_surface_get_stride( image ) );
+
+                XImage* xImage( XShmCreateImage( display, visual, 32, ZPixmap, data, &info, width, height ) );
+                if( xImage )
+                {
+
+                    // copy image rows into segment
+                    const unsigned char* source( cairo_image_surface_get_data( image ) );
+                    for( int row = 0; row < height; ++row )
+                    { memcpy( data + row*xImage->bytes_per_line, source + row*stride, 4*width ); }
+
+                    XShmPutImage( display, pixmaps[i], gc, xImage, 0, 0, 0, 0, width, height, False );
+                    XDestroyImage( xImage );
+
+                }
+
+                data += 4*width*height;
 
             }
 
+            // make sure server is done reading before detaching
+            XShmDetach( display, &info );
+            XSync( display, False );
+
         }
 
-        return pixmap;
+        shmdt( info.shmaddr );
+        return attached;
 
     }
     #endif
 
+    #endif
+
+    //______________________________________________
+    Cairo::Surface ShadowHelper::createImage( const Cairo::Surface& surface, int opacity ) const
+    {
+        assert( surface.isValid() );
+        int width(0);
+        int height(0);
+        cairo_surface_get_size( surface, width, height );
+
+        // image is initially transparent, so that painting with alpha applies opacity in a single pass
+        Cairo::Surface image( cairo_image_surface_create( CAIRO_FORMAT_ARGB32, width, height ) );
+        {
+            Cairo::Context context( image );
+            cairo_set_source_surface( context, surface, 0, 0 );
+            if( opacity < 255 ) cairo_paint_with_alpha( context, double(opacity)/255 );
+            else cairo_paint( context );
+        }
+
+        cairo_surface_flush( image );
+        return image;
+
+    }
+
     //______________________________________________
     void ShadowHelper::installX11Shadows( GtkWidget* widget )
     {
@@ -386,10 +747,13 @@ namespace Oxygen
         // check widget
         if( !GTK_IS_WIDGET( widget ) ) return;
 
+        // check window
+        GdkWindow  *window = gtk_widget_get_window( widget );
+        if( !window ) return;
+
         // make sure handles and atom are defined
         createPixmapHandles();
 
-        GdkWindow  *window = gtk_widget_get_window( widget );
         GdkDisplay *display = gtk_widget_get_display( widget );
 
         std::vector<unsigned long> data;
@@ -431,6 +795,20 @@ namespace Oxygen
 
         }
 
+        // skip if window already has the same property
+        const Window windowId( GDK_WINDOW_XID( window ) );
+        WidgetMap::iterator iter( _widgets.find( widget ) );
+        if( iter != _widgets.end() )
+        {
+
+            WidgetData& widgetData( iter->second );
+            if( widgetData._windowId == windowId && widgetData._shadowData == data ) return;
+
+            widgetData._windowId = windowId;
+            widgetData._shadowData = data;
+
+        }
+
         // change property
         XChangeProperty(
             GDK_DISPLAY_XDISPLAY( display ), GDK_WINDOW_XID(window), _atom, XA_CARDINAL, 32, PropModeReplace,
@@ -441,7 +819,20 @@ namespace Oxygen
     }
 
     //_______________________________________________________
-    void ShadowHelper::uninstallX11Shadows( GtkWidget* widget ) const
+    void ShadowHelper::scheduleX11Shadows( GtkWidget* widget )
+    {
+
+        // do nothing if not supported
+        if( !_supported ) return;
+
+        _pendingWidgets.insert( widget );
+        if( !_installTimer.isRunning() )
+        { _installTimer.start( 0, (GSourceFunc)installPendingShadows, this ); }
+
+    }
+
+    //_______________________________________________________
+    void ShadowHelper::uninstallX11Shadows( GtkWidget* widget )
     {
 
         #ifdef GDK_WINDOWING_X11
@@ -453,10 +844,38 @@ namespace Oxygen
         GdkWindow  *window = gtk_widget_get_window( widget );
         GdkDisplay *display = gtk_widget_get_display( widget );
         XDeleteProperty( GDK_DISPLAY_XDISPLAY( display ), GDK_WINDOW_XID(window), _atom);
+
+        // reset stored property
+        WidgetMap::iterator iter( _widgets.find( widget ) );
+        if( iter != _widgets.end() )
+        {
+            iter->second._windowId = 0;
+            iter->second._shadowData.clear();
+        }
+
         #endif
 
     }
 
+    //_______________________________________________________
+    gboolean ShadowHelper::installPendingShadows( gpointer data )
+    {
+
+        ShadowHelper& helper( *static_cast<ShadowHelper*>( data ) );
+
+        // install shadows for widgets that are still registered
+        WidgetSet widgets;
+        widgets.swap( helper._pendingWidgets );
+        for( WidgetSet::const_iterator iter = widgets.begin(); iter != widgets.end(); ++iter )
+        {
+            if( helper._widgets.find( *iter ) == helper._widgets.end() ) continue;
+            helper.installX11Shadows( *iter );
+        }
+
+        return FALSE;
+
+    }
+
     //_______________________________________________________
     gboolean ShadowHelper::realizeHook( GSignalInvocationHint*, guint, const GValue* params, gpointer data )
     {
@@ -466,6 +885,7 @@ namespace Oxygen
 
         // check type
         if( !GTK_IS_WIDGET( widget ) ) return FALSE;
+        if( !Gtk::TypeFlags::test( widget, Gtk::TypeFlags::Window ) ) return TRUE;
         static_cast<ShadowHelper*>(data)->registerWidget( widget );
         return TRUE;
     }
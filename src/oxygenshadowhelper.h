@@ -20,15 +20,18 @@
 * MA 02110-1301, USA.
 */
 
+#include "config.h"
 #include "oxygenapplicationname.h"
 #include "oxygencairosurface.h"
 #include "oxygenhook.h"
 #include "oxygensignal.h"
 #include "oxygentileset.h"
+#include "oxygentimer.h"
 #include "oxygenwindowshadow.h"
 
 #include <vector>
 #include <map>
+#include <set>
 
 #ifdef GDK_WINDOWING_X11
 #include <X11/Xdefs.h>
@@ -44,11 +47,6 @@ namespace Oxygen
 
         public:
 
-        //!@name property names
-        //@{
-        static const char* const netWMShadowAtomName;
-        //@}
-
         //! constructor
         ShadowHelper( void );
 
@@ -94,9 +92,45 @@ namespace Oxygen
         //! create pixmaps
         void createPixmapHandles( void );
 
-        //! create Pixmap for given surface
         #ifdef GDK_WINDOWING_X11
-        Pixmap createPixmap( const Cairo::Surface&, int opacity = 255 ) const;
+        //! find pixmaps published by another process, for the same shadow configuration
+        bool findSharedPixmaps( void );
+
+        //! publish pixmaps for use by other processes
+        void publishPixmaps( void );
+
+        //! list of windows advertising shared pixmaps, read from root window
+        typedef std::vector<Window> WindowList;
+        WindowList sharedPixmapsOwners( Display*, Window ) const;
+
+        //! called when the window advertising the shared pixmaps is destroyed
+        void sharedPixmapsDestroyed( void );
+
+        //! event filter, to track destruction of shared pixmaps owner
+        static GdkFilterReturn sharedPixmapsFilter( GdkXEvent*, GdkEvent*, gpointer );
+        #endif
+
+        //! pixmap handles
+        typedef std::vector<unsigned long> PixmapList;
+
+        //! client side images
+        typedef std::vector<Cairo::Surface> SurfaceList;
+
+        //! render surface into a client side image, with opacity premultiplied
+        Cairo::Surface createImage( const Cairo::Surface&, int opacity = 255 ) const;
+
+        //! create Pixmaps for given client side images
+        #ifdef GDK_WINDOWING_X11
+        PixmapList createPixmaps( const SurfaceList& ) const;
+
+        //! upload images to pixmaps, one XPutImage per image
+        void putImages( Display*, Visual*, GC, const PixmapList&, const SurfaceList& ) const;
+
+        #if HAVE_XSHM
+        //! upload images to pixmaps through a single shared memory segment. Returns false if not supported
+        bool putImagesShm( Display*, Visual*, GC, const PixmapList&, const SurfaceList& ) const;
+        #endif
+
         #endif
 
         //! install shadow X11 property on given widget
@@ -106,8 +140,18 @@ namespace Oxygen
         */
         void installX11Shadows( GtkWidget* );
 
+        //! install shadow X11 property on given widget, at next main loop iteration
+        /*!
+        requests from the same iteration are batched, and only performed once per widget.
+        Used when shadows change for already mapped windows. Newly realized windows are handled directly
+        */
+        void scheduleX11Shadows( GtkWidget* );
+
         //! uninstall shadow X11 property on given widget
-        void uninstallX11Shadows( GtkWidget* ) const;
+        void uninstallX11Shadows( GtkWidget* );
+
+        //! install scheduled shadows
+        static gboolean installPendingShadows( gpointer );
 
         //! map event hook
         static gboolean realizeHook( GSignalInvocationHint*, guint, const GValue*, gpointer );
@@ -123,6 +167,12 @@ namespace Oxygen
         //! shadow size
         int _size;
 
+        //! shadow opacity
+        enum { ShadowOpacity = 150 };
+
+        //! hash of shadow configuration, used to identify shared pixmaps
+        guint32 _pixmapKey;
+
         //! shadow tileset
         TileSet _roundTiles;
 
@@ -135,13 +185,28 @@ namespace Oxygen
         #ifdef GDK_WINDOWING_X11
         //! shadow atom
         Atom _atom;
+
+        //! shared pixmaps atom
+        Atom _sharedPixmapsAtom;
+
+        //! window advertising the pixmaps in use, either created by this process or by another one
+        /*! pixmaps are destroyed by the X server together with this window, when its owner exits */
+        Window _sharedPixmapsOwner;
+
+        //! true if pixmaps in use were created by this process
+        bool _ownsPixmaps;
+
+        //! true if event filter is installed
+        bool _filterInstalled;
         #endif
 
         //! number of pixmaps
         enum { numPixmaps = 8 };
 
+        //! max number of shadow configurations advertised on root window
+        enum { MaxSharedPixmapSets = 8 };
+
         //! round shadows pixmap handles
-        typedef std::vector<unsigned long> PixmapList;
         PixmapList _roundPixmaps;
 
         //! square shadows pixmap handles
@@ -154,18 +219,32 @@ namespace Oxygen
             public:
 
             //! constructor
-            WidgetData( void )
+            WidgetData( void ):
+                _windowId( 0 )
             {}
 
             //! destroy signal
             Signal _destroyId;
 
+            //! X11 window on which shadow property was last written
+            unsigned long _windowId;
+
+            //! last written shadow property
+            std::vector<unsigned long> _shadowData;
+
         };
 
         //! map widgets and window id
         typedef std::map<GtkWidget*, WidgetData> WidgetMap;
         WidgetMap _widgets;
 
+        //! widgets for which shadows must be installed
+        typedef std::set<GtkWidget*> WidgetSet;
+        WidgetSet _pendingWidgets;
+
+        //! timer used to install pending shadows
+        Timer _installTimer;
+
         //! true if hooks are initialized
         bool _hooksInitialized;
 
@@ -21,6 +21,7 @@
 
 #include "oxygenstyle.h"
 #include "oxygencairocontext.h"
+#include "oxygencairocontextcache.h"
 #include "oxygencairoutils.h"
 #include "oxygencolorutils.h"
 #include "oxygenfontinfo.h"
@@ -28,6 +29,7 @@
 #include "oxygenmetrics.h"
 #include "oxygenwindecobutton.h"
 #include "oxygenwindowshadow.h"
+#include "oxygenx11atoms.h"
 
 #include "oxygengtktypenames.h"
 
@@ -127,13 +129,7 @@ namespace Oxygen
 
         #ifdef GDK_WINDOWING_X11
         if( _blurAtom == None )
-        {
-
-            GdkDisplay *display( gdk_display_get_default() );
-            if( display )
-            { _blurAtom = XInternAtom(GDK_DISPLAY_XDISPLAY( display ),"_KDE_NET_WM_BLUR_BEHIND_REGION",False); }
-
-        }
+        { _blurAtom = X11Atoms::instance().atom( X11Atoms::BlurBehindRegion ); }
 
         #endif
 
@@ -283,7 +279,7 @@ namespace Oxygen
             {
 
                 // create context
-                context = gdk_cairo_create(window);
+                context = Cairo::ContextCache::instance().create( window );
 
                 // set clip rect
                 if( clipRect )
@@ -300,7 +296,7 @@ namespace Oxygen
 
             if( needToDestroyContext )
             {
-                cairo_destroy(context);
+                Cairo::ContextCache::instance().destroy( context );
                 context = 0;
             }
             else cairo_restore(context);
@@ -338,6 +334,9 @@ namespace Oxygen
 
         // if we aren't going to draw window decorations...
         bool needToDestroyContext( false );
+
+        // true if rendered background can be shared with other requests during the current expose
+        bool cacheable( !renderingWindeco );
         if( renderingWindeco )
         {
             // drawing window decorations, so logic is simplified
@@ -354,8 +353,7 @@ namespace Oxygen
             if( !context )
             {
               // create context and translate to toplevel coordinates
-              // make it the old good way since context is cairo_t* instead Cairo::Context
-              context = gdk_cairo_create(window);
+                context = Cairo::ContextCache::instance().create( window );
               needToDestroyContext=true;
 
               if( clipRect )
@@ -393,6 +391,7 @@ namespace Oxygen
                         clipRect->height-=y;
                     }
                     x=y=0;
+                    cacheable = false;
                     #if OXYGEN_DEBUG
                     std::cerr <<"Oxygen::Style::renderBackgroundGradient - setting openoffice-specific coords:"<<wx<<","<<wy<<","<<ww<<","<<wh<<"\n\n";
                     #endif
@@ -403,7 +402,7 @@ namespace Oxygen
                     cairo_set_source(context,base);
                     cairo_rectangle(context,x,y,w,h);
                     cairo_fill(context);
-                    if( needToDestroyContext ) cairo_destroy(context);
+                    if( needToDestroyContext ) Cairo::ContextCache::instance().destroy( context );
                     else cairo_restore(context);
                     return false;
                 }
@@ -420,15 +419,6 @@ namespace Oxygen
 
         }
 
-        if(options&DrawAlphaChannel)
-        {
-            base.setAlpha(_settings.backgroundOpacity()/255.);
-            cairo_set_operator(context,CAIRO_OPERATOR_SOURCE);
-        }
-
-        // split
-        const int splitY( std::min(300, 3*wh/4 ) );
-
         // store rectangle
         GdkRectangle rect = { x, y, w, h };
 
@@ -446,6 +436,68 @@ namespace Oxygen
 
         }
 
+        const bool alpha( options&DrawAlphaChannel );
+        if( alpha ) base.setAlpha(_settings.backgroundOpacity()/255.);
+
+        /*
+        reuse background rendered for the same toplevel during the current expose, if any.
+        Only done when rendering to windows, since toplevel coordinates are then consistent among requests
+        */
+        if( cacheable && window && GDK_IS_WINDOW( window ) && rect.width > 0 && rect.height > 0 )
+        {
+
+            const BackgroundCache::Key key( gdk_window_get_toplevel( window ), base, ww, wh, alpha );
+            GdkRectangle extents( rect );
+            cairo_surface_t* surface( _backgroundCache.find( key, extents ) );
+            if( !surface && ( surface = _backgroundCache.create( key, rect, cairo_get_target( context ) ) ) )
+            {
+
+                // render gradient in new surface
+                cairo_t* local( cairo_create( surface ) );
+                cairo_translate( local, -rect.x, -rect.y );
+                renderBackgroundGradient( local, base, rect, ww, wh, alpha );
+                cairo_destroy( local );
+
+            }
+
+            if( surface )
+            {
+
+                cairo_set_operator( context, alpha ? CAIRO_OPERATOR_SOURCE:CAIRO_OPERATOR_OVER );
+                cairo_set_source_surface( context, surface, extents.x, extents.y );
+                gdk_cairo_rectangle( context, &rect );
+                cairo_fill( context );
+
+                if(needToDestroyContext) Cairo::ContextCache::instance().destroy( context );
+                else cairo_restore(context);
+
+                return true;
+
+            }
+
+        }
+
+        renderBackgroundGradient( context, base, rect, ww, wh, alpha );
+
+        if(needToDestroyContext) Cairo::ContextCache::instance().destroy( context );
+        else cairo_restore(context);
+
+        return true;
+
+    }
+
+    //__________________________________________________________________
+    void Style::renderBackgroundGradient( cairo_t* context, ColorUtils::Rgba base, const GdkRectangle& rect, gint ww, gint wh, bool alpha )
+    {
+
+        // vertical shift to account for window decoration
+        const int yShift = 23;
+
+        if( alpha ) cairo_set_operator(context,CAIRO_OPERATOR_SOURCE);
+
+        // split
+        const int splitY( std::min<int>( BackgroundSplitHeight, 3*wh/4 ) );
+
         // upper rect
         GdkRectangle upperRect = { 0, 0, ww, splitY };
         if( gdk_rectangle_intersect( &rect, &upperRect, &upperRect ) )
@@ -477,7 +529,7 @@ namespace Oxygen
 
         // radial pattern
         const int patternHeight = 64;
-        const int radialW( std::min(600, ww ) );
+        const int radialW( std::min<int>( BackgroundRadialWidth, ww ) );
 
         GdkRectangle radialRect = {  (ww - radialW)/2, 0, radialW, patternHeight };
         if( gdk_rectangle_intersect( &rect, &radialRect, &radialRect ) )
@@ -498,11 +550,6 @@ namespace Oxygen
 
         }
 
-        if(needToDestroyContext) cairo_destroy(context);
-        else cairo_restore(context);
-
-        return true;
-
     }
 
     //__________________________________________________________________
@@ -541,8 +588,7 @@ namespace Oxygen
             if( !context )
             {
               // create context and translate to toplevel coordinates
-              // make it the old good way since context is cairo_t* instead Cairo::Context
-              context = gdk_cairo_create(window);
+                context = Cairo::ContextCache::instance().create( window );
               needToDestroyContext=true;
 
               if( clipRect )
@@ -557,7 +603,7 @@ namespace Oxygen
             // paint flat background when mapping failed
             if( !Gtk::gdk_map_to_toplevel( window, widget, &wx, &wy, &ww, &wh, true ) )
             {
-                if( needToDestroyContext ) cairo_destroy(context);
+                if( needToDestroyContext ) Cairo::ContextCache::instance().destroy( context );
                 else cairo_restore(context);
                 return false;
             }
@@ -607,7 +653,7 @@ namespace Oxygen
         cairo_rectangle( context, 0, 0, ww + wx + 40, wh + wy + 48 - 20 );
         cairo_fill( context );
 
-        if(needToDestroyContext) cairo_destroy(context);
+        if(needToDestroyContext) Cairo::ContextCache::instance().destroy( context );
         else cairo_restore(context);
 
         return true;
@@ -640,8 +686,7 @@ namespace Oxygen
         if( !context )
         {
             // create context and translate to toplevel coordinates
-            // make it the old good way since context is cairo_t* instead Cairo::Context
-            context = gdk_cairo_create(window);
+            context = Cairo::ContextCache::instance().create( window );
             needToDestroyContext=true;
 
             if( clipRect )
@@ -678,7 +723,7 @@ namespace Oxygen
         const int yGroupBox = y - wy - margin;
         renderGroupBox( context, base, xGroupBox, yGroupBox, ww, wh, options );
 
-        if(needToDestroyContext) cairo_destroy(context);
+        if(needToDestroyContext) Cairo::ContextCache::instance().destroy( context );
         else cairo_restore(context);
 
         return true;
@@ -1343,11 +1388,11 @@ namespace Oxygen
         const bool rounded( options&Round );
 
         // if we aren't drawing window decoration
+        const bool needToDestroyContext( !context );
         if( !context )
         {
             // create context
-            // make it the old good way since context is cairo_t* instead Cairo::Context
-            context=gdk_cairo_create(window);
+            context=Cairo::ContextCache::instance().create( window );
             if(clipRect)
             {
                 cairo_rectangle(context,clipRect->x,clipRect->y,clipRect->width,clipRect->height);
@@ -1480,6 +1525,8 @@ namespace Oxygen
         cairo_set_source( context, pattern );
         cairo_set_line_width( context, 0.8 );
         cairo_stroke( context );
+
+        if( needToDestroyContext ) Cairo::ContextCache::instance().destroy( context );
     }
 
     //__________________________________________________________________
@@ -2692,32 +2739,39 @@ namespace Oxygen
 
             Window window((Window)windowStrings[2]);
             Display* display( GDK_DISPLAY_XDISPLAY(gdk_display_get_default()) );
-            if( _animations.backgroundHintEngine().backgroundGradientAtom() != None )
+            const Atom atom( _animations.backgroundHintEngine().backgroundGradientAtom() );
+            if( atom != None && !_windowHintCache.hasBackgroundGradient( display, window, atom ) )
             {
-                Atom typeRet;
-                int formatRet;
-                unsigned long itemsRet;
-                unsigned long afterRet;
-                unsigned char *data = 0;
-
-                if( !( XGetWindowProperty(display, window, _animations.backgroundHintEngine().backgroundGradientAtom(), 0, G_MAXLONG, False,
-                    XA_CARDINAL, &typeRet, &formatRet, &itemsRet, &afterRet, &data) == Success
-                    && itemsRet == 1
-                    && formatRet == 32) )
-                {
-                    // if the window doesn't have this property set, it's likely
-                    // non-oxygenized, thus shouldn't have windeco bg gradient
-                    gradient=false;
-                }
+                // if the window doesn't have this property set, it's likely
+                // non-oxygenized, thus shouldn't have windeco bg gradient
+                gradient=false;
             }
         }
 
-        WindecoBorderKey key(wopt,w,h,gradient);
+        /*
+        cache keys only hold the window dimensions each border depends on, so that borders
+        are reused when a window is resized:
+        - side borders depend on the window width only when the radial gradient reaches them
+        - top and bottom borders depend on the window height only until the vertical gradient split
+        reaches its maximum. For large enough windows they are rendered once at a fixed width and stretched.
+        The background pixmap, if any, depends on both dimensions.
+        */
+        const int borderLeft( WinDeco::getMetric( WinDeco::BorderLeft ) );
+        const int borderRight( WinDeco::getMetric( WinDeco::BorderRight ) );
+        const int borderTop( WinDeco::getMetric( WinDeco::BorderTop ) );
+        const int borderBottom( WinDeco::getMetric( WinDeco::BorderBottom ) );
+        const bool fixedSize( hasBackgroundSurface() );
+
+        // width at which horizontal borders are rendered before being stretched
+        const int stretchWidth( BackgroundRadialWidth + 2*( std::max( borderLeft, borderRight ) + WindecoStretchMargin + 1 ) );
+        const bool stretch( !fixedSize && w >= stretchWidth );
+        const int horizontalWidth( stretch ? stretchWidth : w );
 
         {
             // draw left border with cache
+            WindecoBorderKey key( wopt, stretch ? 0:w, h, gradient );
             Cairo::Surface left( _helper.windecoLeftBorderCache().value(key) );
-            int sw=WinDeco::getMetric(WinDeco::BorderLeft);
+            int sw=borderLeft;
             if(sw)
             {
 
@@ -2750,8 +2804,9 @@ namespace Oxygen
 
         {
             // draw right border with cache
+            WindecoBorderKey key( wopt, stretch ? 0:w, h, gradient );
             Cairo::Surface right( _helper.windecoRightBorderCache().value(key) );
-            int sw=WinDeco::getMetric(WinDeco::BorderRight);
+            int sw=borderRight;
             if(sw)
             {
 
@@ -2785,10 +2840,11 @@ namespace Oxygen
 
         {
             // draw top border with cache
+            WindecoBorderKey key( wopt, horizontalWidth, ( fixedSize || h < WindecoGradientHeight ) ? h:0, gradient );
             Cairo::Surface top( _helper.windecoTopBorderCache().value(key) );
-            int left=WinDeco::getMetric(WinDeco::BorderLeft);
-            int right=WinDeco::getMetric(WinDeco::BorderRight);
-            int sh=WinDeco::getMetric(WinDeco::BorderTop);
+            int left=borderLeft;
+            int right=borderRight;
+            int sh=borderTop;
             int sw=w-left-right;
             if(sh && sw)
             {
@@ -2798,10 +2854,10 @@ namespace Oxygen
                     #if OXYGEN_DEBUG
                     std::cerr<<"drawWindowDecoration: drawing top border; width: " << w << "; height: " << h << "; wopt: " << wopt << std::endl;
                     #endif
-                    top=_helper.createSurface(sw,sh);
+                    top=_helper.createSurface(horizontalWidth-left-right,sh);
 
                     Cairo::Context context(top);
-                    renderWindowDecoration( context, wopt, -left, 0, w, h, windowStrings, titleIndentLeft, titleIndentRight, gradient );
+                    renderWindowDecoration( context, wopt, -left, 0, horizontalWidth, h, windowStrings, titleIndentLeft, titleIndentRight, gradient );
 
                     _helper.windecoTopBorderCache().insert(key,top);
 
@@ -2813,9 +2869,14 @@ namespace Oxygen
 
                 }
 
-                cairo_set_source_surface(context, top, x+left, y);
-                cairo_rectangle(context,x+left,y,sw,sh);
-                cairo_fill(context);
+                if( stretch ) drawStretchedWindecoBorder( context, top, horizontalWidth, x, y, w, sh, left, right );
+                else {
+
+                    cairo_set_source_surface(context, top, x+left, y);
+                    cairo_rectangle(context,x+left,y,sw,sh);
+                    cairo_fill(context);
+
+                }
 
                 // caption shouldn't be saved in the cache
                 if( windowStrings && windowStrings[0] )
@@ -2869,10 +2930,11 @@ namespace Oxygen
 
         {
             // draw bottom border with cache
+            WindecoBorderKey key( wopt, horizontalWidth, ( fixedSize || h < WindecoGradientHeight + borderBottom ) ? h:0, gradient );
             Cairo::Surface bottom( _helper.windecoBottomBorderCache().value(key) );
-            int left=WinDeco::getMetric(WinDeco::BorderLeft);
-            int right=WinDeco::getMetric(WinDeco::BorderRight);
-            int sh=WinDeco::getMetric(WinDeco::BorderBottom);
+            int left=borderLeft;
+            int right=borderRight;
+            int sh=borderBottom;
             int sw=w-left-right;
             int Y=y+h-sh;
             if(sh && sw)
@@ -2883,10 +2945,10 @@ namespace Oxygen
                     #if OXYGEN_DEBUG
                     std::cerr<<"drawWindowDecoration: drawing bottom border; width: " << w << "; height: " << h << "; wopt: " << wopt << std::endl;
                     #endif
-                    bottom=_helper.createSurface(sw,sh);
+                    bottom=_helper.createSurface(horizontalWidth-left-right,sh);
 
                     Cairo::Context context(bottom);
-                    renderWindowDecoration( context, wopt, -left, y-Y, w, h, windowStrings, titleIndentLeft, titleIndentRight, gradient );
+                    renderWindowDecoration( context, wopt, -left, y-Y, horizontalWidth, h, windowStrings, titleIndentLeft, titleIndentRight, gradient );
 
                     _helper.windecoBottomBorderCache().insert(key,bottom);
 
@@ -2898,9 +2960,14 @@ namespace Oxygen
 
                 }
 
-                cairo_set_source_surface(context, bottom, x+left, Y);
-                cairo_rectangle(context,x+left,Y,sw,sh);
-                cairo_fill(context);
+                if( stretch ) drawStretchedWindecoBorder( context, bottom, horizontalWidth, x, Y, w, sh, left, right );
+                else {
+
+                    cairo_set_source_surface(context, bottom, x+left, Y);
+                    cairo_rectangle(context,x+left,Y,sw,sh);
+                    cairo_fill(context);
+
+                }
             }
         }
 
@@ -2908,6 +2975,70 @@ namespace Oxygen
 
     }
 
+    //__________________________________________________________________
+    void Style::drawStretchedWindecoBorder( cairo_t* context, const Cairo::Surface& surface, gint sourceWidth, gint x, gint y, gint w, gint h, gint left, gint right )
+    {
+
+        /*
+        the border is made of fixed left and right ends, and of the radial gradient, centered on the window.
+        Gaps in between are uniform, and filled by repeating the first column that follows each fixed segment.
+        All positions are relative to the window left edge, while the surface starts at the left border.
+        */
+        const int margin( WindecoStretchMargin );
+        const int radialWidth( BackgroundRadialWidth );
+        const int sourceCenter( ( sourceWidth - radialWidth )/2 - left );
+        const int center( ( w - radialWidth )/2 - left );
+        const int sw( w - left - right );
+        const int ssw( sourceWidth - left - right );
+        x += left;
+
+        // fixed segments
+        copyWindecoSegment( context, surface, 0, x, y, margin, h, false );
+        copyWindecoSegment( context, surface, sourceCenter, x+center, y, radialWidth, h, false );
+        copyWindecoSegment( context, surface, ssw-margin, x+sw-margin, y, margin, h, false );
+
+        // gaps
+        copyWindecoSegment( context, surface, margin, x+margin, y, center-margin, h, true );
+        copyWindecoSegment( context, surface, sourceCenter+radialWidth, x+center+radialWidth, y, sw-margin-center-radialWidth, h, true );
+
+    }
+
+    //__________________________________________________________________
+    void Style::copyWindecoSegment( cairo_t* context, const Cairo::Surface& surface, gint sx, gint x, gint y, gint w, gint h, bool repeat )
+    {
+
+        if( w <= 0 || h <= 0 ) return;
+
+        if( !repeat )
+        {
+
+            cairo_set_source_surface( context, surface, x-sx, y );
+
+        } else {
+
+            // repeat a single column
+            #if CAIRO_VERSION >= CAIRO_VERSION_ENCODE(1, 12, 4)
+            Cairo::Surface column( cairo_surface_create_for_rectangle( surface, sx, 0, 1, h ) );
+            #else
+            Cairo::Surface column( cairo_surface_create_similar( surface, CAIRO_CONTENT_COLOR_ALPHA, 1, h ) );
+            {
+                Cairo::Context local( column );
+                cairo_set_source_surface( local, surface, -sx, 0 );
+                cairo_rectangle( local, 0, 0, 1, h );
+                cairo_fill( local );
+            }
+            #endif
+
+            cairo_set_source_surface( context, column, x, y );
+            cairo_pattern_set_extend( cairo_get_source( context ), CAIRO_EXTEND_REPEAT );
+
+        }
+
+        cairo_rectangle( context, x, y, w, h );
+        cairo_fill( context );
+
+    }
+
     //__________________________________________________________________
     void Style::drawWindowShadow( cairo_t* context, WinDeco::Options wopt, gint x, gint y, gint w, gint h )
     {
@@ -2942,6 +3073,40 @@ namespace Oxygen
         button.render( context, x+(w-buttonSize)/2+1,y+(h-buttonSize)/2+1, buttonSize, buttonSize );
     }
 
+    //__________________________________________________________________
+    void Style::drawWindecoButtons( cairo_t* context, const WinDeco::ButtonData* buttons, int count, WinDeco::Options windowState )
+    {
+        if( !( buttons && count > 0 ) ) return;
+
+        // colors and geometry are common to all buttons
+        const WinDeco::ButtonPalette palette( _settings );
+        const int buttonSize( _settings.buttonSize() );
+        const int offset( ( !(windowState & WinDeco::Alpha) && !(windowState & WinDeco::Maximized) ) ? 1:0 );
+
+        cairo_save( context );
+        for( int i = 0; i < count; ++i )
+        {
+
+            const WinDeco::ButtonData& data( buttons[i] );
+
+            // validate arguments
+            if( data.type >= WinDeco::ButtonTypeCount || data.state >= WinDeco::ButtonStatusCount )
+            { continue; }
+
+            // draw Oxygen-way disabled button on inactive window
+            WinDeco::ButtonStatus buttonState( (WinDeco::ButtonStatus) data.state );
+            if( !(windowState & WinDeco::Active) && buttonState == WinDeco::Normal )
+            { buttonState = WinDeco::Disabled; }
+
+            WinDeco::Button button( _settings, _helper, (WinDeco::ButtonType) data.type );
+            button.setState( buttonState );
+            button.render( context, data.x+(data.w-buttonSize)/2+1, data.y+offset+(data.h-buttonSize)/2+1, buttonSize, buttonSize, palette );
+
+        }
+        cairo_restore( context );
+
+    }
+
     //__________________________________________________________________
     void Style::drawWindecoShapeMask( cairo_t* context, WinDeco::Options wopt, gint x, gint y, gint w, gint h )
     {
@@ -2950,10 +3115,11 @@ namespace Oxygen
         cairo_set_operator(context,CAIRO_OPERATOR_SOURCE);
         cairo_paint(context);
 
+        // fill cached region, which matches the aliased rounded rectangle
         cairo_set_source_rgba(context,1,1,1,1);
         cairo_set_operator(context,CAIRO_OPERATOR_OVER);
-        cairo_set_antialias(context,CAIRO_ANTIALIAS_NONE);
-        cairo_rounded_rectangle(context,x,y,w,h,6);
+        cairo_translate(context,x,y);
+        gdk_cairo_region(context,_helper.roundRegion(w,h,6));
         cairo_fill(context);
         cairo_restore(context);
 
@@ -4137,9 +4303,7 @@ namespace Oxygen
         {
 
             // make menus/tooltips/combo lists appear rounded using XShape extension if screen isn't composited
-            GdkPixmap* mask( _helper.roundMask( width, height - 2*verticalMaskOffset) );
-            gdk_window_shape_combine_mask( window, mask, 0, verticalMaskOffset );
-            gdk_pixmap_unref(mask);
+            gdk_window_shape_combine_region( window, _helper.roundRegion( width, height - 2*verticalMaskOffset ), 0, verticalMaskOffset );
 
         } else {
 
@@ -25,6 +25,7 @@
 #include "oxygenanimationdata.h"
 #include "oxygenanimationmodes.h"
 #include "oxygenargbhelper.h"
+#include "oxygenbackgroundcache.h"
 #include "oxygencairocontext.h"
 #include "oxygengeometry.h"
 #include "oxygengtkcellinfo.h"
@@ -40,6 +41,7 @@
 #include "oxygenwidgetexplorer.h"
 #include "oxygenwindecooptions.h"
 #include "oxygenwindecobutton.h"
+#include "oxygenwindowhintcache.h"
 #include "oxygenwindowmanager.h"
 
 #include <gdk/gdk.h>
@@ -157,6 +159,9 @@ namespace Oxygen
         // render background gradient
         bool renderBackgroundGradient( cairo_t*, GdkWindow*, GtkWidget*, GdkRectangle*, gint, gint, gint, gint, const StyleOptions& = StyleOptions(), bool isMaximized=false );
 
+        // render background gradient in given rectangle, in toplevel coordinates
+        void renderBackgroundGradient( cairo_t*, ColorUtils::Rgba, const GdkRectangle&, gint, gint, bool );
+
         // render background pixmap
         bool renderBackgroundPixmap( cairo_t*, GdkWindow*, GtkWidget*, GdkRectangle*, gint, gint, gint, gint, bool isMaximized=false );
 
@@ -320,6 +325,9 @@ namespace Oxygen
         //! draw windeco button
         void drawWindecoButton(cairo_t*,WinDeco::ButtonType,WinDeco::ButtonStatus,WinDeco::Options, gint,gint,gint,gint);
 
+        //! draw all buttons of a titlebar at once, sharing colors and context state
+        void drawWindecoButtons( cairo_t*, const WinDeco::ButtonData*, int, WinDeco::Options );
+
         // adjust scrollbar hole, depending on orientation and buttons settings
         void adjustScrollBarHole( int& x, int& y, int& w, int& h, const StyleOptions& ) const;
 
@@ -430,6 +438,29 @@ namespace Oxygen
         //! internal windeco renderer
         void renderWindowDecoration( cairo_t*, WinDeco::Options, gint, gint, gint, gint, const gchar**, gint, gint, bool = true);
 
+        //! draw horizontal windeco border, stretched from a surface rendered for a smaller window width
+        void drawStretchedWindecoBorder( cairo_t*, const Cairo::Surface&, gint, gint, gint, gint, gint, gint, gint );
+
+        //! copy segment of windeco border surface, optionally repeating its first column
+        void copyWindecoSegment( cairo_t*, const Cairo::Surface&, gint, gint, gint, gint, gint, bool );
+
+        //! metrics used to render background gradient, and cache windeco borders
+        enum
+        {
+            //! max width of the radial background gradient
+            BackgroundRadialWidth = 600,
+
+            //! max height of the vertical background gradient, below which background is flat
+            BackgroundSplitHeight = 300,
+
+            //! window height above which the vertical background gradient does not change
+            /*! split height is 3/4 of the window height, until it reaches BackgroundSplitHeight */
+            WindecoGradientHeight = 4*BackgroundSplitHeight/3,
+
+            //! size of the fixed ends of stretched windeco borders
+            WindecoStretchMargin = 32
+        };
+
         //@}
 
         //!@name utilities
@@ -510,6 +541,9 @@ namespace Oxygen
         //! background surface
         Cairo::Surface _backgroundSurface;
 
+        //! window background rendered during the current expose
+        BackgroundCache _backgroundCache;
+
         //! Tab close buttons
         class TabCloseButtons
         {
@@ -539,6 +573,9 @@ namespace Oxygen
         #ifdef GDK_WINDOWING_X11
         //! Atom to show kwin what regions of translucent windows should be blurred
         Atom _blurAtom;
+
+        //! background hints of decorated client windows
+        WindowHintCache _windowHintCache;
         #endif
 
         //! singleton
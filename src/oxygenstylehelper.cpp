@@ -24,6 +24,7 @@
 #include "oxygencolorutils.h"
 #include "oxygenrgba.h"
 
+#include <algorithm>
 #include <cmath>
 #include <gdk/gdk.h>
 
@@ -596,33 +597,92 @@ namespace Oxygen
     }
 
     //__________________________________________________________________
-    GdkPixmap* StyleHelper::roundMask( int w, int h, int radius ) const
+    const GdkRegion* StyleHelper::roundRegion( int w, int h, int radius )
     {
 
-        GdkPixmap* mask( gdk_pixmap_new( 0L, w, h, 1 ) );
+        const RoundRegionKey key( w, h, radius );
+        if( const GdkRegion* region = _roundRegionCache.value( key ) ) return region;
 
+        /*
+        region matches the aliased fill of cairo_rounded_rectangle( context, 0, 0, w, h, radius ):
+        a pixel is included when its center is inside the path.
+        Rows with identical spans are merged, so that the region contains only a few rectangles,
+        for corners.
+        */
+        double x( 0 );
+        double y( 0 );
+        double width( w );
+        double height( h );
+        double r( radius );
+
+        // same radius adjustment as cairo_rounded_rectangle
+        if( width < 2*r )
+        {
+            const double r0( r );
+            r = 0.5*width;
+            y += r0-r;
+            height -= 2*(r0-r);
+        }
+
+        if( height < 2*r )
+        {
+            const double r0( r );
+            r = 0.5*height;
+            x += r0-r;
+            width -= 2*(r0-r);
+        }
+
+        GdkRegion* region( gdk_region_new() );
+        int firstRow( 0 );
+        int left( 0 );
+        int right( -1 );
+        for( int row = 0; row <= h; ++row )
         {
-            Cairo::Context context( GDK_DRAWABLE(mask) );
 
-            // clear the window
-            cairo_set_operator( context, CAIRO_OPERATOR_SOURCE );
-            cairo_set_source( context, ColorUtils::Rgba::transparent() );
-            cairo_paint( context );
+            // compute span for this row
+            int rowLeft( 0 );
+            int rowRight( -1 );
+            if( row < h )
+            {
+
+                const double center( row + 0.5 );
+                if( center >= y && center <= y + height )
+                {
 
-            // now draw roundrect mask
-            cairo_set_operator( context, CAIRO_OPERATOR_OVER );
-            cairo_set_source( context, ColorUtils::Rgba::black() );
+                    double dy( 0 );
+                    if( center < y + r ) dy = y + r - center;
+                    else if( center > y + height - r ) dy = center - ( y + height - r );
+
+                    if( dy <= r )
+                    {
+                        const double dx( r - std::sqrt( r*r - dy*dy ) );
+                        rowLeft = std::max( 0, int( std::ceil( x + dx - 0.5 ) ) );
+                        rowRight = std::min( w - 1, int( std::floor( x + width - dx - 0.5 ) ) );
+                    }
+
+                }
+
+            }
+
+            if( row < h && rowLeft == left && rowRight == right ) continue;
+
+            // store rectangle for previous rows
+            if( right >= left && row > firstRow )
+            {
+                GdkRectangle rect = { left, firstRow, right - left + 1, row - firstRow };
+                gdk_region_union_with_rect( region, &rect );
+            }
+
+            firstRow = row;
+            left = rowLeft;
+            right = rowRight;
 
-            // FIXME: radius found empirically
-            cairo_rounded_rectangle( context, 0, 0, w, h, radius );
-            cairo_fill( context );
         }
 
-        return mask;
+        return _roundRegionCache.insert( key, region );
 
     }
 
-
     //______________________________________________________________________________
     const TileSet& StyleHelper::holeFocused(
         const ColorUtils::Rgba &base, const ColorUtils::Rgba &fill, const ColorUtils::Rgba &glow,
@@ -23,6 +23,7 @@
 #include "oxygencachekey.h"
 #include "oxygencairosurface.h"
 #include "oxygencairosurfacecache.h"
+#include "oxygenregioncache.h"
 #include "oxygentileset.h"
 #include "oxygentilesetcache.h"
 
@@ -81,6 +82,7 @@ namespace Oxygen
             _windecoRightBorderCache.clear();
             _windecoTopBorderCache.clear();
             _windecoBottomBorderCache.clear();
+            _roundRegionCache.clear();
         }
 
         //! create surface from reference for given width and height
@@ -127,9 +129,12 @@ namespace Oxygen
 
         //@}
 
-        //! rounded mask
-        /*! used for non-composited tooltips and menus */
-        GdkPixmap* roundMask( int w, int h, int radius = 6 ) const;
+        //! rounded mask region
+        /*!
+        used for non-composited tooltips, menus and window decorations.
+        The region is owned by the cache and must not be modified
+        */
+        const GdkRegion* roundRegion( int w, int h, int radius = 6 );
 
         //!@name holes
         //@{
@@ -321,6 +326,9 @@ namespace Oxygen
 
         //@}
 
+        //! rounded mask regions
+        RegionCache<RoundRegionKey> _roundRegionCache;
+
     };
 
 }
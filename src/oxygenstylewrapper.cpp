@@ -43,6 +43,7 @@
 #include "oxygencolorutils.h"
 #include "config.h"
 
+#include <cstring>
 #include <iostream>
 namespace Oxygen
 {
@@ -126,545 +127,583 @@ namespace Oxygen
             return;
         }
 
-        if( d.isBase() || d.isEventBox() || (d.isNull() && Gtk::g_object_is_a( G_OBJECT( widget ), "ShellWindow" ) ) )
+        static const Gtk::TypeName shellWindowType( "ShellWindow" );
+        switch( d.type() )
         {
 
-            // if background pixmap is provided, fallback to default painting
-            if( style->bg_pixmap[state] )
+            case Gtk::Detail::Null:
+            case Gtk::Detail::Base:
+            case Gtk::Detail::EventBox:
             {
-                StyleWrapper::parentClass()->draw_flat_box( style, window, state,
-                    shadow, clipRect, widget, detail,
-                    x, y, w, h );
+                // null detail is only handled for shell windows
+                if( d.isNull() && !Gtk::g_object_is_a( G_OBJECT( widget ), shellWindowType ) ) break;
 
-                return;
-            }
+                // if background pixmap is provided, fallback to default painting
+                if( style->bg_pixmap[state] )
+                {
+                    StyleWrapper::parentClass()->draw_flat_box( style, window, state,
+                        shadow, clipRect, widget, detail,
+                        x, y, w, h );
 
-            // for opera, render flat background, always
-            // (using renderwindowbackground will at best fall back to flat, at worse, render garbage)
-            if( Style::instance().settings().applicationName().isOpera() )
-            {
-                Style::instance().fill( window, clipRect, x, y, w, h, Palette::Window );
-                return;
-            }
+                    return;
+                }
 
-            // do nothing for mozilla, acrobat, gnome applets, and other hint-specific windows
-            if(
-                Style::instance().settings().applicationName().useFlatBackground( widget ) ||
-                Gtk::gtk_widget_is_applet( widget ) ||
-                Gtk::gdk_window_nobackground( window ) )
-            { return; }
+                // for opera, render flat background, always
+                // (using renderwindowbackground will at best fall back to flat, at worse, render garbage)
+                if( Style::instance().settings().applicationName().isOpera() )
+                {
+                    Style::instance().fill( window, clipRect, x, y, w, h, Palette::Window );
+                    return;
+                }
 
-            // if background has been modified, simply fill with background color
-            /*
-            note: this is an inconsistent design choice. In principle we could just
-            - register the widgets to the relevant engines as below
-            - pass the modified color to renderWindowBackground
-            */
-            if( Gtk::gtk_widget_style_is_modified( widget, state, GTK_RC_BG ) )
-            {
-                Style::instance().animations().flatWidgetEngine().registerFlatWidget( widget );
-                Style::instance().fill( window, clipRect, x, y, w, h, Gtk::gdk_get_color( style->bg[state] ) );
-                return;
-            }
+                // do nothing for mozilla, acrobat, gnome applets, and other hint-specific windows
+                if(
+                    Style::instance().settings().applicationName().useFlatBackground( widget ) ||
+                    Gtk::gtk_widget_is_applet( widget ) ||
+                    Gtk::gdk_window_nobackground( window ) )
+                { return; }
 
-            // register to relevant engines
-            if( GTK_IS_WINDOW( widget ) )
-            {
+                // if background has been modified, simply fill with background color
+                /*
+                note: this is an inconsistent design choice. In principle we could just
+                - register the widgets to the relevant engines as below
+                - pass the modified color to renderWindowBackground
+                */
+                if( Gtk::gtk_widget_style_is_modified( widget, state, GTK_RC_BG ) )
+                {
+                    Style::instance().animations().flatWidgetEngine().registerFlatWidget( widget );
+                    Style::instance().fill( window, clipRect, x, y, w, h, Gtk::gdk_get_color( style->bg[state] ) );
+                    return;
+                }
 
-                Style::instance().animations().mainWindowEngine().registerWidget( widget );
+                // register to relevant engines
+                if( GTK_IS_WINDOW( widget ) )
+                {
 
-            } else if( GtkWidget* parent = Gtk::gtk_parent_scrolled_window( widget ) ) {
+                    Style::instance().animations().mainWindowEngine().registerWidget( widget );
 
-                Style::instance().animations().scrollBarEngine().registerScrolledWindow( parent );
+                } else if( GtkWidget* parent = Gtk::gtk_parent_scrolled_window( widget ) ) {
 
-            }
+                    Style::instance().animations().scrollBarEngine().registerScrolledWindow( parent );
 
-            // change gtk dialog button order
-            GtkWidget *toplevel = gtk_widget_get_toplevel( widget );
-            if( GTK_IS_DIALOG( toplevel ) )
-            { Style::instance().animations().dialogEngine().registerWidget( toplevel ); }
+                }
 
-            // render background gradient
-            StyleOptions options;
-            options._customColors.insert( Palette::Window, Gtk::gdk_get_color( style->bg[state] ) );
-            const bool success( Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h, options ) );
-
-            // if widget has flat parent, store in flatWidget engine so that children gets the right background nonetheless
-            if( success && Style::instance().animations().flatWidgetEngine().flatParent( widget ) )
-            { Style::instance().animations().flatWidgetEngine().registerPaintWidget( widget ); }
-
-            // register to window manager
-            if( success &&
-                Gtk::gdk_window_is_base( window ) &&
-                !( GTK_IS_EVENT_BOX( widget ) &&
-                !gtk_event_box_get_above_child( GTK_EVENT_BOX( widget ) ) ) )
-            {
-                BackgroundHints hints( BackgroundGradient );
-                if( Style::instance().hasBackgroundSurface() ) hints |= BackgroundPixmap;
-                Style::instance().animations().backgroundHintEngine().registerWidget( widget, hints );
-            }
+                // change gtk dialog button order
+                GtkWidget *toplevel = gtk_widget_get_toplevel( widget );
+                if( GTK_IS_DIALOG( toplevel ) )
+                { Style::instance().animations().dialogEngine().registerWidget( toplevel ); }
 
-            // possible groupbox background
-            if( d.isEventBox() && Gtk::gtk_parent_groupbox( widget ) )
-            {
-                options |= Blend;
-                Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, options );
-            }
+                // render background gradient
+                StyleOptions options;
+                options._customColors.insert( Palette::Window, Gtk::gdk_get_color( style->bg[state] ) );
+                const bool success( Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h, options ) );
 
-            // also draw possible animated tool button
-            if( !d.isNull() )
-            { draw_animated_button( window, clipRect, widget ); }
+                // if widget has flat parent, store in flatWidget engine so that children gets the right background nonetheless
+                if( success && Style::instance().animations().flatWidgetEngine().flatParent( widget ) )
+                { Style::instance().animations().flatWidgetEngine().registerPaintWidget( widget ); }
 
-            return;
+                // register to window manager
+                if( success &&
+                    Gtk::gdk_window_is_base( window ) &&
+                    !( GTK_IS_EVENT_BOX( widget ) &&
+                    !gtk_event_box_get_above_child( GTK_EVENT_BOX( widget ) ) ) )
+                {
+                    BackgroundHints hints( BackgroundGradient );
+                    if( Style::instance().hasBackgroundSurface() ) hints |= BackgroundPixmap;
+                    Style::instance().animations().backgroundHintEngine().registerWidget( widget, hints );
+                }
 
-        } else if( d.isViewportBin() ) {
+                // possible groupbox background
+                if( d.isEventBox() && Gtk::gtk_parent_groupbox( widget ) )
+                {
+                    options |= Blend;
+                    Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, options );
+                }
 
-            // do nothing for gnome applets
-            if( Gtk::gtk_widget_is_applet( widget ) ) return;
+                // also draw possible animated tool button
+                if( !d.isNull() )
+                { draw_animated_button( window, clipRect, widget ); }
 
-            // for modified bg, fill with flat custom color
-            if( Gtk::gtk_widget_style_is_modified( widget, state, GTK_RC_BG ) )
-            {
+                return;
 
-                Style::instance().fill( window, clipRect, x, y, w, h, Gtk::gdk_get_color( style->bg[state] ) );
+            }
+            break;
 
-            } else if(
-                Style::instance().settings().applicationName().useFlatBackground( widget ) ||
-                !Style::instance().animations().backgroundHintEngine().contains( gtk_widget_get_toplevel( widget ) ) )
+            case Gtk::Detail::ViewportBin:
             {
 
-                // for mozilla and openoffice fill with flat color
-                Style::instance().fill( window, clipRect, x, y, w, h, Palette::Window );
-                return;
+                // do nothing for gnome applets
+                if( Gtk::gtk_widget_is_applet( widget ) ) return;
 
-            } else {
+                // for modified bg, fill with flat custom color
+                if( Gtk::gtk_widget_style_is_modified( widget, state, GTK_RC_BG ) )
+                {
 
-                // make sure that widget is registered to scrolledBarEngine,
-                // so that background gets updated properly
-                if( GtkWidget* parent = Gtk::gtk_parent_scrolled_window( widget ) )
-                { Style::instance().animations().scrollBarEngine().registerScrolledWindow( parent ); }
+                    Style::instance().fill( window, clipRect, x, y, w, h, Gtk::gdk_get_color( style->bg[state] ) );
 
-                // render background gradient
-                Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h );
+                } else if(
+                    Style::instance().settings().applicationName().useFlatBackground( widget ) ||
+                    !Style::instance().animations().backgroundHintEngine().contains( gtk_widget_get_toplevel( widget ) ) )
+                {
 
-            }
+                    // for mozilla and openoffice fill with flat color
+                    Style::instance().fill( window, clipRect, x, y, w, h, Palette::Window );
+                    return;
 
-            // also draw possible animated tool button
-            draw_animated_button( window, clipRect, widget );
+                } else {
 
-            return;
+                    // make sure that widget is registered to scrolledBarEngine,
+                    // so that background gets updated properly
+                    if( GtkWidget* parent = Gtk::gtk_parent_scrolled_window( widget ) )
+                    { Style::instance().animations().scrollBarEngine().registerScrolledWindow( parent ); }
 
-        } else if( d.isTrough() ) {
+                    // render background gradient
+                    Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h );
 
-            if( GTK_IS_PROGRESS_BAR( widget ) )
-            {
-                if( Style::instance().settings().applicationName().isOpenOffice() )
-                {
-                    StyleOptions options;
-                    if( Gtk::gtk_widget_is_vertical( widget ) ) options |= Vertical;
-                    Style::instance().renderProgressBarHole( window, clipRect, x,y,w,h, options );
                 }
-                return;
-            }
 
-        } else if( d.isTooltip() && Style::instance().settings().tooltipDrawStyledFrames() ) {
+                // also draw possible animated tool button
+                draw_animated_button( window, clipRect, widget );
 
-            // mozilla and openoffice get square non Argb tooltips no matter what
-            if(
-                Style::instance().settings().applicationName().isOpenOffice() ||
-                Style::instance().settings().applicationName().isXul() )
-            {
-                Style::instance().renderTooltipBackground( window, clipRect, x, y, w, h, StyleOptions() );
                 return;
-            }
 
-            StyleOptions options( Round );
-            if( Gtk::gtk_widget_has_rgba( widget ) ) options |= Alpha;
+            }
+            break;
 
-            if( GDK_IS_WINDOW( window ) )
+            case Gtk::Detail::Trough:
             {
-                WidgetSizeEngine& engine( Style::instance().animations().widgetSizeEngine() );
-                engine.registerWidget( widget );
-                if( engine.update(widget) )
+
+                if( GTK_IS_PROGRESS_BAR( widget ) )
                 {
-                    Style::instance().adjustMask( widget, engine.width( widget ), engine.height( widget ), engine.alpha( widget ) );
-                    Style::instance().setWindowBlur( widget, engine.alpha( widget ) );
+                    if( Style::instance().settings().applicationName().isOpenOffice() )
+                    {
+                        StyleOptions options;
+                        if( Gtk::gtk_widget_is_vertical( widget ) ) options |= Vertical;
+                        Style::instance().renderProgressBarHole( window, clipRect, x,y,w,h, options );
+                    }
+                    return;
                 }
-            }
 
-            Style::instance().renderTooltipBackground( window, clipRect, x, y, w, h, options );
-            return;
+            }
+            break;
 
-        } else if(
-            d.isCheckButton() ||
-            d.isRadioButton() ||
-            d.isExpander() ) {
+            case Gtk::Detail::Tooltip:
+            {
+                if( !Style::instance().settings().tooltipDrawStyledFrames() ) break;
 
-            return;
+                // mozilla and openoffice get square non Argb tooltips no matter what
+                if(
+                    Style::instance().settings().applicationName().isOpenOffice() ||
+                    Style::instance().settings().applicationName().isXul() )
+                {
+                    Style::instance().renderTooltipBackground( window, clipRect, x, y, w, h, StyleOptions() );
+                    return;
+                }
 
-        } else if( d.isCell() ) {
+                StyleOptions options( Round );
+                if( Gtk::gtk_widget_has_rgba( widget ) ) options |= Alpha;
 
-            StyleOptions options( widget, state );
+                if( GDK_IS_WINDOW( window ) )
+                {
+                    WidgetSizeEngine& engine( Style::instance().animations().widgetSizeEngine() );
+                    engine.registerWidget( widget );
+                    if( engine.update(widget) )
+                    { engine.scheduleUpdate( widget, WidgetSizeEngine::UpdateMask|WidgetSizeEngine::UpdateBlur ); }
+                }
 
-            // select palete colorgroup for cell background
-            Palette::Group group( Palette::Active );
-            if( options & Disabled ) group = Palette::Disabled;
-            else if( !(options&Focus) ) group = Palette::Inactive;
+                Style::instance().renderTooltipBackground( window, clipRect, x, y, w, h, options );
+                return;
 
-            // render background
-            // render "normal" background
-            bool drawTreeLines( true );
-            ColorUtils::Rgba background;
+            }
+            break;
 
-            if( Gtk::gtk_widget_style_is_modified( widget, GTK_STATE_NORMAL, GTK_RC_BASE ) )
+            case Gtk::Detail::CheckButton:
+            case Gtk::Detail::RadioButton:
+            case Gtk::Detail::Expander:
             {
 
-                /*
-                do not draw tree lines when a custom background color is set
-                since it usually does not work for non-selected items
-                */
-                drawTreeLines = false;
+                return;
 
-                // assign background
-                background = Gtk::gdk_get_color( style->base[GTK_STATE_NORMAL] );
+            }
+            break;
 
-            } else if( widget && std::string( G_OBJECT_TYPE_NAME( widget ) ).find( "MiroTreeView" ) != std::string::npos ) {
+            case Gtk::Detail::Cell:
+            {
 
-                drawTreeLines = false;
+                StyleOptions options( widget, state );
 
-            } else if( d.isCellEven() || Gtk::gtk_combobox_is_tree_view( widget ) ) {
+                // select palete colorgroup for cell background
+                Palette::Group group( Palette::Active );
+                if( options & Disabled ) group = Palette::Disabled;
+                else if( !(options&Focus) ) group = Palette::Inactive;
 
-                background = Style::instance().settings().palette().color( group, Palette::Base );
+                // render background
+                // render "normal" background
+                bool drawTreeLines( true );
+                ColorUtils::Rgba background;
 
-            } else if( d.isCellOdd() ) {
+                if( Gtk::gtk_widget_style_is_modified( widget, GTK_STATE_NORMAL, GTK_RC_BASE ) )
+                {
 
-                background = Style::instance().settings().palette().color( group, Palette::BaseAlternate );
+                    /*
+                    do not draw tree lines when a custom background color is set
+                    since it usually does not work for non-selected items
+                    */
+                    drawTreeLines = false;
 
-            }
+                    // assign background
+                    background = Gtk::gdk_get_color( style->base[GTK_STATE_NORMAL] );
 
-            if( background.isValid() ) Style::instance().fill( window, clipRect, x, y, w, h, background );
-            if( Gtk::gtk_combobox_is_tree_view( widget ) )
-            {
+                } else if( widget && strstr( G_OBJECT_TYPE_NAME( widget ), "MiroTreeView" ) ) {
 
-                // draw flat selection in combobox list
-                if(state==GTK_STATE_SELECTED)
-                {
-                    ColorUtils::Rgba selection( Style::instance().settings().palette().color( Palette::Active, Palette::Selected ) );
-                    Style::instance().fill( window, clipRect, x, y, w, h, selection );
-                }
+                    drawTreeLines = false;
 
-            } else {
+                } else if( d.isCellEven() || Gtk::gtk_combobox_is_tree_view( widget ) ) {
 
-                const bool reversed( Gtk::gtk_widget_layout_is_reversed( widget ) );
+                    background = Style::instance().settings().palette().color( group, Palette::Base );
 
-                // draw rounded selection in normal list,
-                // and detect hover
-                bool forceCellStart( false );
-                bool forceCellEnd( false );
-                if( GTK_IS_TREE_VIEW( widget ) )
-                {
+                } else if( d.isCellOdd() ) {
 
-                    GtkTreeView* treeView( GTK_TREE_VIEW( widget ) );
-                    Gtk::CellInfo cellInfo( treeView, x, y, w, h );
+                    background = Style::instance().settings().palette().color( group, Palette::BaseAlternate );
 
-                    Style::instance().animations().treeViewEngine().registerWidget( widget );
-                    if( Style::instance().animations().treeViewEngine().isDirty( widget ) )
-                    { Style::instance().animations().treeViewEngine().updateHoveredCell( widget ); }
+                }
 
-                    if( cellInfo.isValid() && Style::instance().animations().treeViewEngine().isCellHovered( widget, cellInfo ) )
-                    { options |= Hover; }
+                if( background.isValid() ) Style::instance().fill( window, clipRect, x, y, w, h, background );
+                if( Gtk::gtk_combobox_is_tree_view( widget ) )
+                {
 
-                    const bool showExpanders( gtk_tree_view_get_show_expanders( treeView ) );
-                    if( showExpanders && cellInfo.isValid() && cellInfo.isExpanderColumn( treeView ))
+                    // draw flat selection in combobox list
+                    if(state==GTK_STATE_SELECTED)
                     {
+                        ColorUtils::Rgba selection( Style::instance().settings().palette().color( Palette::Active, Palette::Selected ) );
+                        Style::instance().fill( window, clipRect, x, y, w, h, selection );
+                    }
 
-                        // tree lines
-                        if( drawTreeLines && Style::instance().settings().viewDrawTreeBranchLines() && showExpanders )
-                        {
+                } else {
 
-                            // generate flags from cell info
-                            Gtk::CellInfoFlags cellFlags( treeView, cellInfo );
-                            if( reversed ) cellFlags._flags |= Gtk::CellInfoFlags::Reversed;
+                    const bool reversed( Gtk::gtk_widget_layout_is_reversed( widget ) );
 
-                            // set proper options
-                            StyleOptions options( widget, state, shadow );
+                    // draw rounded selection in normal list,
+                    // and detect hover
+                    bool forceCellStart( false );
+                    bool forceCellEnd( false );
+                    if( GTK_IS_TREE_VIEW( widget ) )
+                    {
 
-                            // and render
-                            Style::instance().renderTreeLines( window, clipRect, x, y, w, h, cellFlags, options );
+                        GtkTreeView* treeView( GTK_TREE_VIEW( widget ) );
+                        Gtk::CellInfo cellInfo( treeView, x, y, w, h );
 
-                        }
+                        Style::instance().animations().treeViewEngine().registerWidget( widget );
+                        if( Style::instance().animations().treeViewEngine().isDirty( widget ) )
+                        { Style::instance().animations().treeViewEngine().updateHoveredCell( widget ); }
 
-                        // change selection rect so that it does not overlap with expander
-                        if( reversed ) forceCellEnd = true;
-                        else forceCellStart = true;
+                        if( cellInfo.isValid() && Style::instance().animations().treeViewEngine().isCellHovered( widget, cellInfo ) )
+                        { options |= Hover; }
 
-                        forceCellStart = true;
-                        if( options&(Selected|Hover) )
+                        const bool showExpanders( gtk_tree_view_get_show_expanders( treeView ) );
+                        if( showExpanders && cellInfo.isValid() && cellInfo.isExpanderColumn( treeView ))
                         {
 
-                            // get expander size from widget
-                            int depth( cellInfo.depth() );
-                            int expanderSize(0);
-                            gtk_widget_style_get( widget, "expander-size", &expanderSize, NULL );
+                            // tree lines
+                            if( drawTreeLines && Style::instance().settings().viewDrawTreeBranchLines() && showExpanders )
+                            {
 
-                            int offset( 3 + expanderSize * depth + ( 4 + gtk_tree_view_get_level_indentation( treeView ) )*(depth-1) );
+                                // generate flags from cell info
+                                Gtk::CellInfoFlags cellFlags( treeView, cellInfo );
+                                if( reversed ) cellFlags._flags |= Gtk::CellInfoFlags::Reversed;
 
-                            if( reversed ) w-= offset;
-                            else {
+                                // set proper options
+                                StyleOptions options( widget, state, shadow );
 
-                                x += offset;
-                                w -= offset;
+                                // and render
+                                Style::instance().renderTreeLines( window, clipRect, x, y, w, h, cellFlags, options );
 
                             }
 
-                        }
+                            // change selection rect so that it does not overlap with expander
+                            if( reversed ) forceCellEnd = true;
+                            else forceCellStart = true;
 
-                    } else if( showExpanders && (options&(Selected|Hover)) && cellInfo.isValid() && cellInfo.isLeftOfExpanderColumn( treeView ) ) {
+                            forceCellStart = true;
+                            if( options&(Selected|Hover) )
+                            {
 
-                        if( reversed ) forceCellStart = true;
-                        else forceCellEnd = true;
+                                // get expander size from widget
+                                int depth( cellInfo.depth() );
+                                int expanderSize(0);
+                                gtk_widget_style_get( widget, "expander-size", &expanderSize, NULL );
 
-                    }
+                                int offset( 3 + expanderSize * depth + ( 4 + gtk_tree_view_get_level_indentation( treeView ) )*(depth-1) );
+
+                                if( reversed ) w-= offset;
+                                else {
+
+                                    x += offset;
+                                    w -= offset;
+
+                                }
+
+                            }
+
+                        } else if( showExpanders && (options&(Selected|Hover)) && cellInfo.isValid() && cellInfo.isLeftOfExpanderColumn( treeView ) ) {
 
-                    // check if column is last
-                    if( (options&(Selected|Hover)) && cellInfo.isValid() )
-                    {
-                        if(cellInfo.isLastVisibleColumn( treeView ))
-                        {
                             if( reversed ) forceCellStart = true;
                             else forceCellEnd = true;
+
                         }
-                        if(cellInfo.isFirstVisibleColumn( treeView ))
+
+                        // check if column is last
+                        if( (options&(Selected|Hover)) && cellInfo.isValid() )
                         {
-                            if( reversed ) forceCellEnd = true;
-                            else forceCellStart = true;
+                            if(cellInfo.isLastVisibleColumn( treeView ))
+                            {
+                                if( reversed ) forceCellStart = true;
+                                else forceCellEnd = true;
+                            }
+                            if(cellInfo.isFirstVisibleColumn( treeView ))
+                            {
+                                if( reversed ) forceCellEnd = true;
+                                else forceCellStart = true;
+                            }
                         }
+
                     }
 
-                }
+                    if( options & (Selected|Hover) )
+                    {
 
-                if( options & (Selected|Hover) )
-                {
+                        TileSet::Tiles tiles( TileSet::Center );
+                        if( d.isCellStart() ) tiles |= TileSet::Left;
+                        else if( d.isCellEnd() ) tiles |= TileSet::Right;
+                        else if( !d.isCellMiddle() ) tiles = TileSet::Horizontal;
 
-                    TileSet::Tiles tiles( TileSet::Center );
-                    if( d.isCellStart() ) tiles |= TileSet::Left;
-                    else if( d.isCellEnd() ) tiles |= TileSet::Right;
-                    else if( !d.isCellMiddle() ) tiles = TileSet::Horizontal;
+                        if( forceCellStart ) tiles |= TileSet::Left;
+                        if( forceCellEnd ) tiles |= TileSet::Right;
 
-                    if( forceCellStart ) tiles |= TileSet::Left;
-                    if( forceCellEnd ) tiles |= TileSet::Right;
+                        Style::instance().renderSelection( window, clipRect, x, y, w, h, tiles, options );
 
-                    Style::instance().renderSelection( window, clipRect, x, y, w, h, tiles, options );
+                    }
 
                 }
 
-            }
-
-            return;
-
-
-        } else if( d.isIconViewItem() ) {
+                return;
 
-            StyleOptions options( widget, state );
-            if( options&(Selected|Hover) )
-            {
-                // adjustments have been tuned empirically
-                Style::instance().renderSelection( window, clipRect, x, y, w, h, TileSet::Full, options );
             }
-            return;
-
-        } else if( d.isEntryBg() && !Style::instance().settings().applicationName().isXul( widget ) ) {
+            break;
 
-            // FIXME: how to detect Chromium address bar more correctly?
-            const bool isChromeAddressBar( widget &&
-                    GTK_IS_HBOX(widget) &&
-                    Style::instance().settings().applicationName().isGoogleChrome() );
-            if(Style::instance().settings().applicationName().isOpenOffice())
+            case Gtk::Detail::IconViewItem:
             {
-                const char* ver=Style::instance().settings().applicationName().versionString();
-                // If ver appears non-NULL, we have at least LibO 4.0.
-                // For now, it's enough to differentiate old version from new.
-                // If something gets broken in newer version, we'll have to parse ver.
-                if(ver)
-                {
-                    x-=3;
-                    w+=6;
-                }
-                else
+
+                StyleOptions options( widget, state );
+                if( options&(Selected|Hover) )
                 {
-                    x+=2;
-                    w-=4;
-                    y+=1;
-                    h-=2;
+                    // adjustments have been tuned empirically
+                    Style::instance().renderSelection( window, clipRect, x, y, w, h, TileSet::Full, options );
                 }
+                return;
+
             }
+            break;
 
-            StyleOptions options( widget, state, shadow );
-            if(
-                !Style::instance().settings().applicationName().isGoogleChrome() &&
-                !Style::instance().settings().applicationName().isOpenOffice( widget ) )
-            { options |= NoFill; }
+            case Gtk::Detail::EntryBg:
+            {
+                if( Style::instance().settings().applicationName().isXul( widget ) ) break;
 
-            // calculate proper offsets so that the glow/shadow match parent frame
-            const int sideMargin( isChromeAddressBar ? 0 : std::max( 0, style->xthickness - 2 ) );
-            const int xOffset( style->xthickness + 1 - sideMargin );
+                // FIXME: how to detect Chromium address bar more correctly?
+                const bool isChromeAddressBar( widget &&
+                        GTK_IS_HBOX(widget) &&
+                        Style::instance().settings().applicationName().isGoogleChrome() );
+                if(Style::instance().settings().applicationName().isOpenOffice())
+                {
+                    const char* ver=Style::instance().settings().applicationName().versionString();
+                    // If ver appears non-NULL, we have at least LibO 4.0.
+                    // For now, it's enough to differentiate old version from new.
+                    // If something gets broken in newer version, we'll have to parse ver.
+                    if(ver)
+                    {
+                        x-=3;
+                        w+=6;
+                    }
+                    else
+                    {
+                        x+=2;
+                        w-=4;
+                        y+=1;
+                        h-=2;
+                    }
+                }
 
-            // adjust horizontal positioning and width
-            x -= xOffset;
-            w += 2*xOffset;
+                StyleOptions options( widget, state, shadow );
+                if(
+                    !Style::instance().settings().applicationName().isGoogleChrome() &&
+                    !Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                { options |= NoFill; }
 
-            if( GtkWidget* parent = Gtk::gtk_parent_combobox_entry( widget ) )
-            {
+                // calculate proper offsets so that the glow/shadow match parent frame
+                const int sideMargin( isChromeAddressBar ? 0 : std::max( 0, style->xthickness - 2 ) );
+                const int xOffset( style->xthickness + 1 - sideMargin );
 
-                // check if parent is in style map
-                Style::instance().animations().comboBoxEntryEngine().registerWidget( parent );
-                Style::instance().animations().comboBoxEntryEngine().setEntry( parent, widget );
-                Style::instance().animations().comboBoxEntryEngine().setEntryFocus( parent, options & Focus );
+                // adjust horizontal positioning and width
+                x -= xOffset;
+                w += 2*xOffset;
 
-                if( state != GTK_STATE_INSENSITIVE )
+                if( GtkWidget* parent = Gtk::gtk_parent_combobox_entry( widget ) )
                 {
-                    if( Style::instance().animations().comboBoxEntryEngine().hasFocus( parent ) ) options |= Focus;
-                    else options &= ~Focus;
 
-                    if(  Style::instance().animations().comboBoxEntryEngine().hovered( parent ) ) options |= Hover;
-                    else options &= ~Hover;
-                }
+                    // check if parent is in style map
+                    Style::instance().animations().comboBoxEntryEngine().registerWidget( parent );
+                    Style::instance().animations().comboBoxEntryEngine().setEntry( parent, widget );
+                    Style::instance().animations().comboBoxEntryEngine().setEntryFocus( parent, options & Focus );
 
-                /*
-                for some reason, adjusting y and h using ythickness does not work for combobox_entry
-                one need to use parent allocation instead
-                */
-                const GtkAllocation allocation( Gtk::gtk_widget_get_allocation( parent ) );
-                y -= (allocation.height-h + 1)/2;
-                h = allocation.height;
+                    if( state != GTK_STATE_INSENSITIVE )
+                    {
+                        if( Style::instance().animations().comboBoxEntryEngine().hasFocus( parent ) ) options |= Focus;
+                        else options &= ~Focus;
 
-                // partial highlight
-                TileSet::Tiles tiles( TileSet::Ring );
-                const AnimationData data( Style::instance().animations().widgetStateEngine().get( parent, options, AnimationHover|AnimationFocus, AnimationFocus ) );
-                if( Gtk::gtk_widget_layout_is_reversed( widget ) )
-                {
+                        if(  Style::instance().animations().comboBoxEntryEngine().hovered( parent ) ) options |= Hover;
+                        else options &= ~Hover;
+                    }
 
-                    // hide left part and increase width
-                    tiles &= ~TileSet::Left;
-                    Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin-2, y, w+2*sideMargin+2, h, TileSet::Full, sideMargin );
-                    Style::instance().renderHole( window, clipRect, x-9, y, w+9, h, options, data, tiles );
+                    /*
+                    for some reason, adjusting y and h using ythickness does not work for combobox_entry
+                    one need to use parent allocation instead
+                    */
+                    const GtkAllocation allocation( Gtk::gtk_widget_get_allocation( parent ) );
+                    y -= (allocation.height-h + 1)/2;
+                    h = allocation.height;
 
-                } else {
+                    // partial highlight
+                    TileSet::Tiles tiles( TileSet::Ring );
+                    const AnimationData data( Style::instance().animations().widgetStateEngine().get( parent, options, AnimationHover|AnimationFocus, AnimationFocus ) );
+                    if( Gtk::gtk_widget_layout_is_reversed( widget ) )
+                    {
 
-                    // hide right part and increase width
-                    tiles &= ~TileSet::Right;
-                    Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin, y, w+2*sideMargin+2, h, TileSet::Full, sideMargin );
-                    Style::instance().renderHole( window, clipRect, x, y, w+9, h, options, data, tiles );
+                        // hide left part and increase width
+                        tiles &= ~TileSet::Left;
+                        Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin-2, y, w+2*sideMargin+2, h, TileSet::Full, sideMargin );
+                        Style::instance().renderHole( window, clipRect, x-9, y, w+9, h, options, data, tiles );
 
-                }
+                    } else {
 
-            } else if( GTK_IS_SPIN_BUTTON( widget ) ) {
+                        // hide right part and increase width
+                        tiles &= ~TileSet::Right;
+                        Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin, y, w+2*sideMargin+2, h, TileSet::Full, sideMargin );
+                        Style::instance().renderHole( window, clipRect, x, y, w+9, h, options, data, tiles );
 
-                // do nothing for frameless entries
-                if( !gtk_entry_get_has_frame( GTK_ENTRY( widget ) ) )
-                { return; }
+                    }
 
-                const int yOffset( style->ythickness + 1 );
+                } else if( GTK_IS_SPIN_BUTTON( widget ) ) {
 
-                // there is no need to render anything if both offsets are larger than 4
-                if( xOffset > 4 && yOffset > 4 ) return;
+                    // do nothing for frameless entries
+                    if( !gtk_entry_get_has_frame( GTK_ENTRY( widget ) ) )
+                    { return; }
 
-                // adjust vertical positioning and height
-                y -= yOffset;
-                h += 2*yOffset;
+                    const int yOffset( style->ythickness + 1 );
 
-                // for libreoffice do nothing
-                if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
-                { return; }
+                    // there is no need to render anything if both offsets are larger than 4
+                    if( xOffset > 4 && yOffset > 4 ) return;
 
-                if(
-                    Style::instance().animations().hoverEngine().contains( widget ) &&
-                    Style::instance().animations().hoverEngine().hovered( widget ) )
-                { options |= Hover; }
+                    // adjust vertical positioning and height
+                    y -= yOffset;
+                    h += 2*yOffset;
 
-                // plain background
-                ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[gtk_widget_get_state(widget)] ) );
-                Style::instance().fill( window, clipRect, x, y, w, h, background );
+                    // for libreoffice do nothing
+                    if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                    { return; }
 
-                // animation data
-                const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
+                    if(
+                        Style::instance().animations().hoverEngine().contains( widget ) &&
+                        Style::instance().animations().hoverEngine().hovered( widget ) )
+                    { options |= Hover; }
 
-                // hole
-                TileSet::Tiles tiles( TileSet::Ring );
-                if( Gtk::gtk_widget_layout_is_reversed( widget ) )
-                {
+                    // plain background
+                    ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[gtk_widget_get_state(widget)] ) );
+                    Style::instance().fill( window, clipRect, x, y, w, h, background );
 
-                    // hide right part and adjust width
-                    tiles &= ~TileSet::Left;
-                    Style::instance().renderHoleBackground( window, widget, clipRect, x-2-sideMargin, y, w+2*sideMargin+2, h, tiles, sideMargin );
-                    Style::instance().renderHole( window, clipRect, x-7, y, w+7, h, options, data, tiles );
+                    // animation data
+                    const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
 
-                } else {
+                    // hole
+                    TileSet::Tiles tiles( TileSet::Ring );
+                    if( Gtk::gtk_widget_layout_is_reversed( widget ) )
+                    {
 
-                    // hide right part and adjust width
-                    tiles &= ~TileSet::Right;
-                    Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin, y, w+2*sideMargin, h, tiles, sideMargin );
-                    Style::instance().renderHole( window, clipRect, x, y, w+7, h, options, data, tiles );
+                        // hide right part and adjust width
+                        tiles &= ~TileSet::Left;
+                        Style::instance().renderHoleBackground( window, widget, clipRect, x-2-sideMargin, y, w+2*sideMargin+2, h, tiles, sideMargin );
+                        Style::instance().renderHole( window, clipRect, x-7, y, w+7, h, options, data, tiles );
 
-                }
+                    } else {
 
-            } else {
+                        // hide right part and adjust width
+                        tiles &= ~TileSet::Right;
+                        Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin, y, w+2*sideMargin, h, tiles, sideMargin );
+                        Style::instance().renderHole( window, clipRect, x, y, w+7, h, options, data, tiles );
 
-                // do nothing for frameless entries
-                if( GTK_IS_ENTRY( widget ) && !gtk_entry_get_has_frame( GTK_ENTRY( widget ) ) )
-                { return; }
+                    }
 
-                const int yOffset( style->ythickness + 1 );
+                } else {
 
-                // there is no need to render anything if both offsets are larger than 4
-                if( xOffset > 4 && yOffset > 4 ) return;
+                    // do nothing for frameless entries
+                    if( GTK_IS_ENTRY( widget ) && !gtk_entry_get_has_frame( GTK_ENTRY( widget ) ) )
+                    { return; }
 
-                // adjust vertical positioning and height
-                y -= yOffset;
-                h += 2*yOffset;
+                    const int yOffset( style->ythickness + 1 );
 
-                if(
-                    Style::instance().animations().hoverEngine().contains( widget ) &&
-                    Style::instance().animations().hoverEngine().hovered( widget ) )
-                { options |= Hover; }
+                    // there is no need to render anything if both offsets are larger than 4
+                    if( xOffset > 4 && yOffset > 4 ) return;
 
-                // compare painting rect to widget rect, to decide if some sides are to be masked
-                TileSet::Tiles tiles = TileSet::Ring;
-                GdkWindow* widgetWindow( gtk_widget_get_window( widget ) );
-                if( widget && window != widgetWindow && GDK_IS_WINDOW( window ) && widgetWindow == gdk_window_get_parent( window )  )
-                {
+                    // adjust vertical positioning and height
+                    y -= yOffset;
+                    h += 2*yOffset;
 
-                    const int widgetWindowWidth( Gtk::gtk_widget_get_allocation( widget ).width );
-                    int localWindowX( 0 );
-                    int localWindowWidth( 0 );
-                    gdk_window_get_position( window, &localWindowX, 0L );
-                    gdk_window_get_size( window, &localWindowWidth, 0L );
+                    if(
+                        Style::instance().animations().hoverEngine().contains( widget ) &&
+                        Style::instance().animations().hoverEngine().hovered( widget ) )
+                    { options |= Hover; }
 
-                    // remove left border if needed
-                    if( localWindowX > 5 )
+                    // compare painting rect to widget rect, to decide if some sides are to be masked
+                    TileSet::Tiles tiles = TileSet::Ring;
+                    GdkWindow* widgetWindow( gtk_widget_get_window( widget ) );
+                    if( widget && window != widgetWindow && GDK_IS_WINDOW( window ) && widgetWindow == gdk_window_get_parent( window )  )
                     {
-                        tiles &= ~TileSet::Left;
-                        x -= 9;
-                        w += 9;
-                    }
 
-                    // remove right border if needed
-                    if( localWindowX + localWindowWidth < widgetWindowWidth - 5 )
-                    {
-                        tiles &= ~TileSet::Right;
-                        w += 9;
+                        const int widgetWindowWidth( Gtk::gtk_widget_get_allocation( widget ).width );
+                        int localWindowX( 0 );
+                        int localWindowWidth( 0 );
+                        gdk_window_get_position( window, &localWindowX, 0L );
+                        gdk_window_get_size( window, &localWindowWidth, 0L );
+
+                        // remove left border if needed
+                        if( localWindowX > 5 )
+                        {
+                            tiles &= ~TileSet::Left;
+                            x -= 9;
+                            w += 9;
+                        }
+
+                        // remove right border if needed
+                        if( localWindowX + localWindowWidth < widgetWindowWidth - 5 )
+                        {
+                            tiles &= ~TileSet::Right;
+                            w += 9;
+                        }
+
                     }
 
+                    // render hole
+                    Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin, y, w+2*sideMargin, h, TileSet::Full, sideMargin );
+                    const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
+                    Style::instance().renderHole( window, clipRect, x, y, w, h, options, data, tiles );
+
                 }
 
-                // render hole
-                Style::instance().renderHoleBackground( window, widget, clipRect, x-sideMargin, y, w+2*sideMargin, h, TileSet::Full, sideMargin );
-                const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
-                Style::instance().renderHole( window, clipRect, x, y, w, h, options, data, tiles );
+                return;
 
             }
+            break;
 
-            return;
+            default: break;
 
         }
 
@@ -755,878 +794,964 @@ namespace Oxygen
         { return; }
 
         GtkWidget* parent(0L);
-        if( d.isInfoBar() )
+        switch( d.type() )
         {
 
-            Style::instance().renderInfoBar( window, clipRect, x, y, w, h, Gtk::gdk_get_color( style->bg[state] ) );
+            case Gtk::Detail::InfoBar:
+            {
 
+                Style::instance().renderInfoBar( window, clipRect, x, y, w, h, Gtk::gdk_get_color( style->bg[state] ) );
 
-        } else if( d.isButton() || d.isOptionMenu() || d.isToggleButton() ) {
+            }
+            break;
 
-            // pathbar buttons
-            if( Gtk::gtk_button_is_in_path_bar(widget) )
+            case Gtk::Detail::Button:
+            case Gtk::Detail::OptionMenu:
+            case Gtk::Detail::ToggleButton:
             {
 
-                // https://bugzilla.gnome.org/show_bug.cgi?id=635511
-                std::string name(G_OBJECT_TYPE_NAME( gtk_widget_get_parent( widget ) ) );
-                Style::instance().animations().hoverEngine().registerWidget( widget );
-
-                // only two style options possible: hover or don't draw
-                StyleOptions options;
-                const bool reversed( Gtk::gtk_widget_layout_is_reversed( widget ) );
-                const bool isLast( Gtk::gtk_path_bar_button_is_last( widget ) );
-                if(state!=GTK_STATE_NORMAL && state!=GTK_STATE_INSENSITIVE)
+                // pathbar buttons
+                if( Gtk::gtk_button_is_in_path_bar(widget) )
                 {
-                    if( !(state==GTK_STATE_ACTIVE && !Style::instance().animations().hoverEngine().hovered( widget ) ) )
+
+                    // https://bugzilla.gnome.org/show_bug.cgi?id=635511
+                    std::string name(G_OBJECT_TYPE_NAME( gtk_widget_get_parent( widget ) ) );
+                    Style::instance().animations().hoverEngine().registerWidget( widget );
+
+                    // only two style options possible: hover or don't draw
+                    StyleOptions options;
+                    const bool reversed( Gtk::gtk_widget_layout_is_reversed( widget ) );
+                    const bool isLast( Gtk::gtk_path_bar_button_is_last( widget ) );
+                    if(state!=GTK_STATE_NORMAL && state!=GTK_STATE_INSENSITIVE)
                     {
-                        options |= Hover;
-                        if( isLast )
+                        if( !(state==GTK_STATE_ACTIVE && !Style::instance().animations().hoverEngine().hovered( widget ) ) )
                         {
-                            if( reversed )
+                            options |= Hover;
+                            if( isLast )
                             {
+                                if( reversed )
+                                {
 
-                                x += 10;
-                                w-=10;
+                                    x += 10;
+                                    w-=10;
 
-                            } else w -= 10;
-                        }
+                                } else w -= 10;
+                            }
 
-                        Style::instance().renderSelection(window,clipRect,x,y,w,h,TileSet::Full,options);
+                            Style::instance().renderSelection(window,clipRect,x,y,w,h,TileSet::Full,options);
+                        }
                     }
-                }
 
-                if( GTK_IS_TOGGLE_BUTTON(widget) && !isLast )
-                {
+                    if( GTK_IS_TOGGLE_BUTTON(widget) && !isLast )
+                    {
 
-                    options |= Contrast;
+                        options |= Contrast;
 
-                    if( reversed ) Style::instance().renderArrow(window,NULL,GTK_ARROW_LEFT, x+3,y,5,h,QtSettings::ArrowNormal, options, Palette::WindowText);
-                    else Style::instance().renderArrow(window,NULL,GTK_ARROW_RIGHT,x+w-8,y,5,h,QtSettings::ArrowNormal, options, Palette::WindowText);
+                        if( reversed ) Style::instance().renderArrow(window,NULL,GTK_ARROW_LEFT, x+3,y,5,h,QtSettings::ArrowNormal, options, Palette::WindowText);
+                        else Style::instance().renderArrow(window,NULL,GTK_ARROW_RIGHT,x+w-8,y,5,h,QtSettings::ArrowNormal, options, Palette::WindowText);
 
-                }
-
-                return;
+                    }
 
-            }
+                    return;
 
-            // treeview headers
-            if( Gtk::gtk_button_is_header( widget ) )
-            {
+                }
 
-                // register to scrolled window engine if any
-                if(
-                    ( parent = Gtk::gtk_parent_scrolled_window( widget ) ) &&
-                    Style::instance().animations().scrolledWindowEngine().contains( parent )
-                    )
-                { Style::instance().animations().scrolledWindowEngine().registerChild( parent, widget ); }
+                // treeview headers
+                if( Gtk::gtk_button_is_header( widget ) )
+                {
 
-                // treevew header
-                Style::instance().renderHeaderBackground( window, clipRect, x, y, w, h );
-                return;
+                    // register to scrolled window engine if any
+                    if(
+                        ( parent = Gtk::gtk_parent_scrolled_window( widget ) ) &&
+                        Style::instance().animations().scrolledWindowEngine().contains( parent )
+                        )
+                    { Style::instance().animations().scrolledWindowEngine().registerChild( parent, widget ); }
 
-            }
+                    // treevew header
+                    Style::instance().renderHeaderBackground( window, clipRect, x, y, w, h );
+                    return;
 
-            // combobox entry buttons
-            if( ( parent = Gtk::gtk_parent_combobox_entry( widget ) ) ) {
+                }
 
                 // combobox entry buttons
-                // keep track of whether button is active (pressed-down) or pre-lighted
-                const bool buttonActive( state == GTK_STATE_ACTIVE || state == GTK_STATE_PRELIGHT );
+                if( ( parent = Gtk::gtk_parent_combobox_entry( widget ) ) ) {
 
-                // get the state from the combobox
-                /* this fixes rendering issues when the arrow is disabled, but not the entry */
-                state = gtk_widget_get_state(parent);
+                    // combobox entry buttons
+                    // keep track of whether button is active (pressed-down) or pre-lighted
+                    const bool buttonActive( state == GTK_STATE_ACTIVE || state == GTK_STATE_PRELIGHT );
 
-                /*
-                editable combobox button get a hole (with left corner hidden), and a background
-                that match the corresponding text entry background.
-                */
+                    // get the state from the combobox
+                    /* this fixes rendering issues when the arrow is disabled, but not the entry */
+                    state = gtk_widget_get_state(parent);
 
-                StyleOptions options( widget, state, shadow );
-                if(
-                    !Style::instance().settings().applicationName().isOpenOffice( widget ) &&
-                    !Style::instance().settings().applicationName().isGoogleChrome() )
-                { options |= NoFill; }
-
-                if(!Style::instance().settings().applicationName().useFlatBackground( widget ))
-                { options |= Blend; }
+                    /*
+                    editable combobox button get a hole (with left corner hidden), and a background
+                    that match the corresponding text entry background.
+                    */
 
-                // focus handling
-                Style::instance().animations().comboBoxEntryEngine().registerWidget( parent );
-                Style::instance().animations().comboBoxEntryEngine().setButton( parent, widget );
+                    StyleOptions options( widget, state, shadow );
+                    if(
+                        !Style::instance().settings().applicationName().isOpenOffice( widget ) &&
+                        !Style::instance().settings().applicationName().isGoogleChrome() )
+                    { options |= NoFill; }
 
-                // background
-                int sideMargin( 0 );
-                {
-                    GtkWidget* entry( gtk_bin_get_child( GTK_BIN( parent ) ) );
-                    GtkStyle* style( gtk_widget_get_style( entry ) );
-                    sideMargin = std::max( 0, style->xthickness - 2 );
-                    ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[state] ) );
-                    Style::instance().fill( window, clipRect, x, y, w, h, background );
-                }
+                    if(!Style::instance().settings().applicationName().useFlatBackground( widget ))
+                    { options |= Blend; }
 
-                // update option accordingly
-                if( state == GTK_STATE_INSENSITIVE ) options &= ~(Hover|Focus);
-                else {
+                    // focus handling
+                    Style::instance().animations().comboBoxEntryEngine().registerWidget( parent );
+                    Style::instance().animations().comboBoxEntryEngine().setButton( parent, widget );
 
-                    Style::instance().animations().comboBoxEntryEngine().setButtonFocus( parent, options & Focus );
-                    if( Style::instance().animations().comboBoxEntryEngine().hasFocus( parent ) ) options |= Focus;
-                    else options &= ~Focus;
+                    // background
+                    int sideMargin( 0 );
+                    {
+                        GtkWidget* entry( gtk_bin_get_child( GTK_BIN( parent ) ) );
+                        GtkStyle* style( gtk_widget_get_style( entry ) );
+                        sideMargin = std::max( 0, style->xthickness - 2 );
+                        ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[state] ) );
+                        Style::instance().fill( window, clipRect, x, y, w, h, background );
+                    }
 
-                    // properly set button hover state. Pressed-down buttons are marked hovered, consistently with Qt
-                    Style::instance().animations().comboBoxEntryEngine().setButtonHovered( parent, buttonActive );
-                    if( Style::instance().animations().comboBoxEntryEngine().hovered( parent ) ) options |= Hover;
-                    else options &= ~Hover;
+                    // update option accordingly
+                    if( state == GTK_STATE_INSENSITIVE ) options &= ~(Hover|Focus);
+                    else {
 
-                }
+                        Style::instance().animations().comboBoxEntryEngine().setButtonFocus( parent, options & Focus );
+                        if( Style::instance().animations().comboBoxEntryEngine().hasFocus( parent ) ) options |= Focus;
+                        else options &= ~Focus;
 
-                // render
-                TileSet::Tiles tiles( TileSet::Ring);
-                const AnimationData data( Style::instance().animations().widgetStateEngine().get( parent, options, AnimationHover|AnimationFocus, AnimationFocus ) );
-                if( Gtk::gtk_widget_layout_is_reversed( widget ) )
-                {
+                        // properly set button hover state. Pressed-down buttons are marked hovered, consistently with Qt
+                        Style::instance().animations().comboBoxEntryEngine().setButtonHovered( parent, buttonActive );
+                        if( Style::instance().animations().comboBoxEntryEngine().hovered( parent ) ) options |= Hover;
+                        else options &= ~Hover;
 
-                    // hide right and adjust width
-                    tiles &= ~TileSet::Right;
-                    Style::instance().renderHoleBackground( window, widget, clipRect, x-1, y, w+6, h, tiles, sideMargin );
+                    }
 
-                    x += sideMargin;
-                    w -= sideMargin;
-                    Style::instance().renderHole( window, clipRect, x-1, y, w+8, h, options, data, tiles  );
+                    // render
+                    TileSet::Tiles tiles( TileSet::Ring);
+                    const AnimationData data( Style::instance().animations().widgetStateEngine().get( parent, options, AnimationHover|AnimationFocus, AnimationFocus ) );
+                    if( Gtk::gtk_widget_layout_is_reversed( widget ) )
+                    {
 
-                } else {
+                        // hide right and adjust width
+                        tiles &= ~TileSet::Right;
+                        Style::instance().renderHoleBackground( window, widget, clipRect, x-1, y, w+6, h, tiles, sideMargin );
 
-                    // hide left and adjust width
-                    tiles &= ~TileSet::Left;
-                    Style::instance().renderHoleBackground( window, widget, clipRect, x-5, y, w+6, h, tiles, sideMargin );
+                        x += sideMargin;
+                        w -= sideMargin;
+                        Style::instance().renderHole( window, clipRect, x-1, y, w+8, h, options, data, tiles  );
 
-                    w -= sideMargin;
-                    Style::instance().renderHole( window, clipRect, x-7, y, w+8, h, options, data, tiles  );
+                    } else {
 
-                }
+                        // hide left and adjust width
+                        tiles &= ~TileSet::Left;
+                        Style::instance().renderHoleBackground( window, widget, clipRect, x-5, y, w+6, h, tiles, sideMargin );
 
-                return;
+                        w -= sideMargin;
+                        Style::instance().renderHole( window, clipRect, x-7, y, w+8, h, options, data, tiles  );
 
-            }
+                    }
 
-            // combobox buttons
-            if(
-                ( parent = Gtk::gtk_parent_combobox( widget ) ) &&
-                !Style::instance().settings().applicationName().isXul( widget ) &&
-                Gtk::gtk_combobox_appears_as_list( parent )
-                )
-            {
+                    return;
 
-                {
-                    // Set minimum combobox button height if it's smaller
-                    GtkAllocation alloc;
-                    gtk_widget_get_allocation(widget,&alloc);
-                    gtk_widget_get_size_request(widget,&alloc.width,NULL);
-                    if(alloc.height<22)
-                        gtk_widget_set_size_request(widget,alloc.width,22);
                 }
-                // combobox buttons
-                const bool reversed( Gtk::gtk_widget_layout_is_reversed( widget ) );
 
-                StyleOptions options( widget, state, shadow );
-                if(!Style::instance().settings().applicationName().useFlatBackground( widget ))
-                { options |= Blend; }
-
-                Style::instance().animations().comboBoxEngine().registerWidget( parent );
-                Style::instance().animations().comboBoxEngine().setButton( parent, widget );
-                Style::instance().animations().comboBoxEngine().setButtonFocus( parent, options & Focus );
-
-                if( Gtk::gtk_combobox_has_frame( parent ) )
+                // combobox buttons
+                if(
+                    ( parent = Gtk::gtk_parent_combobox( widget ) ) &&
+                    !Style::instance().settings().applicationName().isXul( widget ) &&
+                    Gtk::gtk_combobox_appears_as_list( parent )
+                    )
                 {
-                    if( Style::instance().animations().comboBoxEngine().hovered( parent ) ) options |= Hover;
 
-                    // tiles
-                    TileSet::Tiles tiles( TileSet::Ring );
+                    {
+                        // Set minimum combobox button height if it's smaller
+                        GtkAllocation alloc;
+                        gtk_widget_get_allocation(widget,&alloc);
+                        gtk_widget_get_size_request(widget,&alloc.width,NULL);
+                        if(alloc.height<22)
+                            gtk_widget_set_size_request(widget,alloc.width,22);
+                    }
+                    // combobox buttons
+                    const bool reversed( Gtk::gtk_widget_layout_is_reversed( widget ) );
+
+                    StyleOptions options( widget, state, shadow );
+                    if(!Style::instance().settings().applicationName().useFlatBackground( widget ))
+                    { options |= Blend; }
 
-                    // animation state
-                    const AnimationData data( (options&Sunken) ?
-                        AnimationData():
-                        Style::instance().animations().widgetStateEngine().get( parent, options ) );
+                    Style::instance().animations().comboBoxEngine().registerWidget( parent );
+                    Style::instance().animations().comboBoxEngine().setButton( parent, widget );
+                    Style::instance().animations().comboBoxEngine().setButtonFocus( parent, options & Focus );
 
-                    if( reversed )
+                    if( Gtk::gtk_combobox_has_frame( parent ) )
                     {
+                        if( Style::instance().animations().comboBoxEngine().hovered( parent ) ) options |= Hover;
 
-                        tiles &= ~TileSet::Right;
-                        Style::instance().renderButtonSlab( window, clipRect, x, y, w+7, h, options, data, tiles );
+                        // tiles
+                        TileSet::Tiles tiles( TileSet::Ring );
 
-                    } else {
+                        // animation state
+                        const AnimationData data( (options&Sunken) ?
+                            AnimationData():
+                            Style::instance().animations().widgetStateEngine().get( parent, options ) );
 
-                        tiles &= ~TileSet::Left;
-                        Style::instance().renderButtonSlab( window, clipRect, x-7, y, w+7, h, options, data, tiles );
+                        if( reversed )
+                        {
 
-                    }
+                            tiles &= ~TileSet::Right;
+                            Style::instance().renderButtonSlab( window, clipRect, x, y, w+7, h, options, data, tiles );
 
-                    return;
+                        } else {
 
-                } else {
+                            tiles &= ~TileSet::Left;
+                            Style::instance().renderButtonSlab( window, clipRect, x-7, y, w+7, h, options, data, tiles );
 
-                    options |= Flat;
-                    if( Style::instance().animations().comboBoxEngine().hovered( parent ) ) options |= Hover;
-                    if( reversed ) Style::instance().renderButtonSlab( window, clipRect, x+1, y, w, h, options );
-                    else Style::instance().renderButtonSlab( window, clipRect, x-1, y, w, h, options );
-                    return;
+                        }
 
-                }
+                        return;
 
-            }
+                    } else {
 
-            // combo button
-            if( ( parent = Gtk::gtk_parent_combo( widget ) ) )
-            {
+                        options |= Flat;
+                        if( Style::instance().animations().comboBoxEngine().hovered( parent ) ) options |= Hover;
+                        if( reversed ) Style::instance().renderButtonSlab( window, clipRect, x+1, y, w, h, options );
+                        else Style::instance().renderButtonSlab( window, clipRect, x-1, y, w, h, options );
+                        return;
 
-                StyleOptions options( widget, state, shadow );
-                if(!Style::instance().settings().applicationName().useFlatBackground(widget))
-                { options |= Blend; }
+                    }
 
-                if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                }
+
+                // combo button
+                if( ( parent = Gtk::gtk_parent_combo( widget ) ) )
                 {
 
-                    // Hover doesn't work correctly in OpenOffice, so disable it
-                    options &= ~(Hover|Focus);
-                    TileSet::Tiles tiles( TileSet::Full );
-                    tiles &= ( ~TileSet::Left );
-                    Style::instance().renderHole( window, clipRect, x-10, y-1, w+11, h+2, options, tiles );
-                    return;
+                    StyleOptions options( widget, state, shadow );
+                    if(!Style::instance().settings().applicationName().useFlatBackground(widget))
+                    { options |= Blend; }
 
-                } else {
+                    if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                    {
 
-                    /*
-                    make button flat; disable focus and hover
-                    (this is handled when rendering the arrow
-                    This doesn't work for OpenOffice.
-                    */
-                    options |= Flat;
-                    options &= ~(Hover|Focus);
-                    Style::instance().animations().comboEngine().registerWidget( parent );
-                    return;
+                        // Hover doesn't work correctly in OpenOffice, so disable it
+                        options &= ~(Hover|Focus);
+                        TileSet::Tiles tiles( TileSet::Full );
+                        tiles &= ( ~TileSet::Left );
+                        Style::instance().renderHole( window, clipRect, x-10, y-1, w+11, h+2, options, tiles );
+                        return;
 
-                }
+                    } else {
 
-            }
+                        /*
+                        make button flat; disable focus and hover
+                        (this is handled when rendering the arrow
+                        This doesn't work for OpenOffice.
+                        */
+                        options |= Flat;
+                        options &= ~(Hover|Focus);
+                        Style::instance().animations().comboEngine().registerWidget( parent );
+                        return;
 
-            // notebook close buttons
-            if( Gtk::gtk_notebook_is_close_button(widget))
-            {
+                    }
 
-                if( gtk_button_get_relief(GTK_BUTTON(widget))==GTK_RELIEF_NONE )
-                { gtk_button_set_relief(GTK_BUTTON(widget),GTK_RELIEF_NORMAL); }
+                }
 
-                if( Cairo::Surface surface = processTabCloseButton(widget,state) )
+                // notebook close buttons
+                if( Gtk::gtk_notebook_is_close_button(widget))
                 {
 
-                    // hide previous image
-                    // show ours instead
-                    if( GtkWidget* image = Gtk::gtk_button_find_image(widget) )
-                    { gtk_widget_hide(image); }
+                    if( gtk_button_get_relief(GTK_BUTTON(widget))==GTK_RELIEF_NONE )
+                    { gtk_button_set_relief(GTK_BUTTON(widget),GTK_RELIEF_NORMAL); }
 
-                    // center the button image
-                    int width(0);
-                    int height(0);
-                    cairo_surface_get_size( surface, width, height );
-                    x += (w-width)/2;
-                    y += (h-height)/2;
+                    if( Cairo::Surface surface = processTabCloseButton(widget,state) )
+                    {
 
-                    // render the image
-                    Cairo::Context context( window, clipRect );
-                    cairo_set_source_surface( context, surface, x, y);
-                    cairo_paint(context);
+                        // hide previous image
+                        // show ours instead
+                        if( GtkWidget* image = Gtk::gtk_button_find_image(widget) )
+                        { gtk_widget_hide(image); }
 
-                }
+                        // center the button image
+                        int width(0);
+                        int height(0);
+                        cairo_surface_get_size( surface, width, height );
+                        x += (w-width)/2;
+                        y += (h-height)/2;
 
-                return;
+                        // render the image
+                        Cairo::Context context( window, clipRect );
+                        cairo_set_source_surface( context, surface, x, y);
+                        cairo_paint(context);
 
-            }
+                    }
 
-            #if GTK_CHECK_VERSION(2, 20, 0)
-            // tool itemgroup buttons
-            if( GTK_IS_TOOL_ITEM_GROUP( widget ) ) return;
-            #endif
+                    return;
 
-            // for google chrome, make GtkChromeButton appear as flat
-            if(
-                Style::instance().settings().applicationName().isGoogleChrome() &&
-                !Gtk::gtk_button_is_flat( widget ) &&
-                Gtk::g_object_is_a( G_OBJECT( widget ), "GtkChromeButton" ) )
-            { gtk_button_set_relief( GTK_BUTTON( widget ), GTK_RELIEF_NONE ); }
+                }
 
-            // options
-            StyleOptions options( widget, state, shadow );
-            if(!Style::instance().settings().applicationName().useFlatBackground(widget))
-            { options |= Blend; }
+                #if GTK_CHECK_VERSION(2, 20, 0)
+                // tool itemgroup buttons
+                if( GTK_IS_TOOL_ITEM_GROUP( widget ) ) return;
+                #endif
 
-            // default case
-            if( style )
-            { options._customColors.insert( options&Flat ? Palette::Window:Palette::Button, Gtk::gdk_get_color( style->bg[state] ) ); }
+                // for google chrome, make GtkChromeButton appear as flat
+                static const Gtk::TypeName chromeButtonType( "GtkChromeButton" );
+                if(
+                    Style::instance().settings().applicationName().isGoogleChrome() &&
+                    !Gtk::gtk_button_is_flat( widget ) &&
+                    Gtk::g_object_is_a( G_OBJECT( widget ), chromeButtonType ) )
+                { gtk_button_set_relief( GTK_BUTTON( widget ), GTK_RELIEF_NONE ); }
 
-            // flat buttons
-            bool useWidgetState( true );
-            AnimationData data;
-            // Such small buttons should rather be flat for OpenOffice (the only ones present there seem
-            // to be the navigation buttons under vertical scrollbar in main window)
-            bool ooFlat(Style::instance().settings().applicationName().isOpenOffice() && w<20 && h<20 && w==h);
-            // LibO formula entry expand expand button is very small, would look better if rendered flat
-            bool ooFormulaExpand(Style::instance().settings().applicationName().isOpenOffice() && w==16);
+                // options
+                StyleOptions options( widget, state, shadow );
+                if(!Style::instance().settings().applicationName().useFlatBackground(widget))
+                { options |= Blend; }
 
-            if( (widget && Gtk::gtk_button_is_flat( widget )) || ooFlat || ooFormulaExpand )
-            {
+                // default case
+                if( style )
+                { options._customColors.insert( options&Flat ? Palette::Window:Palette::Button, Gtk::gdk_get_color( style->bg[state] ) ); }
+
+                // flat buttons
+                bool useWidgetState( true );
+                AnimationData data;
+                // Such small buttons should rather be flat for OpenOffice (the only ones present there seem
+                // to be the navigation buttons under vertical scrollbar in main window)
+                bool ooFlat(Style::instance().settings().applicationName().isOpenOffice() && w<20 && h<20 && w==h);
+                // LibO formula entry expand expand button is very small, would look better if rendered flat
+                bool ooFormulaExpand(Style::instance().settings().applicationName().isOpenOffice() && w==16);
+
+                if( (widget && Gtk::gtk_button_is_flat( widget )) || ooFlat || ooFormulaExpand )
+                {
 
-                // set button as flat and disable focus
-                options |= Flat;
-                options &= ~Focus;
+                    // set button as flat and disable focus
+                    options |= Flat;
+                    options &= ~Focus;
 
-                if(!Style::instance().settings().applicationName().isOpenOffice())
-                {
-                    // register to Hover engine and check state
-                    Style::instance().animations().hoverEngine().registerWidget( widget );
-                    if( (options&Hover) )  Style::instance().animations().hoverEngine().setHovered( widget, true );
-                    else if( Style::instance().animations().hoverEngine().hovered( widget ) ) options |= Hover;
+                    if(!Style::instance().settings().applicationName().isOpenOffice())
+                    {
+                        // register to Hover engine and check state
+                        Style::instance().animations().hoverEngine().registerWidget( widget );
+                        if( (options&Hover) )  Style::instance().animations().hoverEngine().setHovered( widget, true );
+                        else if( Style::instance().animations().hoverEngine().hovered( widget ) ) options |= Hover;
 
-                    // register to ToolBarState engine
-                    ToolBarStateEngine& engine( Style::instance().animations().toolBarStateEngine() );
-                    GtkWidget* parent( 0L );
+                        // register to ToolBarState engine
+                        ToolBarStateEngine& engine( Style::instance().animations().toolBarStateEngine() );
+                        GtkWidget* parent( 0L );
 
-                    bool toolPalette(false);
-                    #if GTK_CHECK_VERSION(2,20,0)
-                    toolPalette=Gtk::gtk_widget_find_parent( widget, GTK_TYPE_TOOL_PALETTE );
-                    #endif
+                        bool toolPalette(false);
+                        #if GTK_CHECK_VERSION(2,20,0)
+                        toolPalette=Gtk::gtk_widget_find_parent( widget, GTK_TYPE_TOOL_PALETTE );
+                        #endif
 
-                    if( !toolPalette && (parent = engine.findParent( widget ) ) )
-                    {
+                        if( !toolPalette && (parent = engine.findParent( widget ) ) )
+                        {
 
-                        // register child
-                        engine.registerChild( parent, widget, options&Hover );
-                        useWidgetState = false;
+                            // register child
+                            engine.registerChild( parent, widget, options&Hover );
+                            useWidgetState = false;
 
-                        if( engine.animatedRectangleIsValid( parent ) && !(options&Sunken) ) {
+                            if( engine.animatedRectangleIsValid( parent ) && !(options&Sunken) ) {
 
-                            return;
+                                return;
 
-                        } if( engine.widget( parent, AnimationCurrent ) == widget ) {
+                            } if( engine.widget( parent, AnimationCurrent ) == widget ) {
 
-                            data = engine.animationData( parent, AnimationCurrent );
+                                data = engine.animationData( parent, AnimationCurrent );
 
-                            if( engine.isLocked( parent ) ) options |= Hover;
+                                if( engine.isLocked( parent ) ) options |= Hover;
 
-                        } else if( (options & Sunken ) && engine.widget( parent, AnimationPrevious ) == widget ) {
+                            } else if( (options & Sunken ) && engine.widget( parent, AnimationPrevious ) == widget ) {
 
-                            data = engine.animationData( parent, AnimationPrevious );
+                                data = engine.animationData( parent, AnimationPrevious );
 
-                        }
+                            }
 
+                        }
+                    }
+                    else if(ooFlat)
+                    {
+                        // Fill with bottom color because the buttons are most likely at the bottom
+                        Cairo::Context context(window);
+                        cairo_set_source(context,ColorUtils::backgroundBottomColor( Style::instance().settings().palette().color( Palette::Window )));
+                        cairo_rectangle(context,x,y,w,h);
+                        cairo_fill(context);
                     }
-                }
-                else if(ooFlat)
-                {
-                    // Fill with bottom color because the buttons are most likely at the bottom
-                    Cairo::Context context(window);
-                    cairo_set_source(context,ColorUtils::backgroundBottomColor( Style::instance().settings().palette().color( Palette::Window )));
-                    cairo_rectangle(context,x,y,w,h);
-                    cairo_fill(context);
-                }
 
-            }
+                }
 
-            // retrieve animation
-            if( useWidgetState )
-            { data = Style::instance().animations().widgetStateEngine().get( widget, options ); }
+                // retrieve animation
+                if( useWidgetState )
+                { data = Style::instance().animations().widgetStateEngine().get( widget, options ); }
 
-            if(Style::instance().settings().applicationName().isOpenOffice())
-                Style::instance().renderWindowBackground(window,clipRect,x,y,w,h);
-            // render
-            Style::instance().renderButtonSlab( window, clipRect, x, y, w, h, options, data );
+                if(Style::instance().settings().applicationName().isOpenOffice())
+                    Style::instance().renderWindowBackground(window,clipRect,x,y,w,h);
+                // render
+                Style::instance().renderButtonSlab( window, clipRect, x, y, w, h, options, data );
 
-        } else if( d.isMenuBar() ) {
+            }
+            break;
 
-            if( !Style::instance().settings().applicationName().useFlatBackground( widget ) &&
-                !Gtk::gtk_widget_is_applet( widget ) )
+            case Gtk::Detail::MenuBar:
             {
 
-                StyleOptions options;
+                if( !Style::instance().settings().applicationName().useFlatBackground( widget ) &&
+                    !Gtk::gtk_widget_is_applet( widget ) )
+                {
 
-                if( style )
-                { options._customColors.insert( Palette::Window, Gtk::gdk_get_color( style->bg[state] ) ); }
+                    StyleOptions options;
 
-                // window background
-                Style::instance().renderWindowBackground( window, clipRect, x, y, w, h, options );
+                    if( style )
+                    { options._customColors.insert( Palette::Window, Gtk::gdk_get_color( style->bg[state] ) ); }
 
-                // possible groupbox background
-                if( Gtk::gtk_parent_groupbox( widget ) )
-                { Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, Blend ); }
+                    // window background
+                    Style::instance().renderWindowBackground( window, clipRect, x, y, w, h, options );
 
-            }
-            // check animation state
-            if( GTK_IS_MENU_BAR( widget ) )
-            {
+                    // possible groupbox background
+                    if( Gtk::gtk_parent_groupbox( widget ) )
+                    { Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, Blend ); }
+
+                }
+                // check animation state
+                if( GTK_IS_MENU_BAR( widget ) )
+                {
+
+                    MenuBarStateEngine& engine( Style::instance().animations().menuBarStateEngine() );
+                    engine.registerWidget(widget);
+                    if( engine.animatedRectangleIsValid( widget ) )
+                    {
 
-                MenuBarStateEngine& engine( Style::instance().animations().menuBarStateEngine() );
-                engine.registerWidget(widget);
-                if( engine.animatedRectangleIsValid( widget ) )
-                {
+                        const GdkRectangle& rect( engine.animatedRectangle( widget ) );
+                        StyleOptions options( Hover );
+                        if( !Style::instance().settings().applicationName().useFlatBackground( widget ) )
+                        { options |= Blend; }
 
-                    const GdkRectangle& rect( engine.animatedRectangle( widget ) );
-                    StyleOptions options( Hover );
-                    if( !Style::instance().settings().applicationName().useFlatBackground( widget ) )
-                    { options |= Blend; }
+                        Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationCurrent ), rect.x, rect.y, rect.width, rect.height, options );
 
-                    Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationCurrent ), rect.x, rect.y, rect.width, rect.height, options );
+                    } else if( engine.isAnimated( widget, AnimationPrevious ) ) {
 
-                } else if( engine.isAnimated( widget, AnimationPrevious ) ) {
+                        const AnimationData data( engine.animationData( widget, AnimationPrevious ) );
+                        const GdkRectangle& rect( engine.rectangle( widget, AnimationPrevious ) );
+                        StyleOptions options( Hover );
+                        if( !Style::instance().settings().applicationName().useFlatBackground( widget ) )
+                        { options |= Blend; }
 
-                    const AnimationData data( engine.animationData( widget, AnimationPrevious ) );
-                    const GdkRectangle& rect( engine.rectangle( widget, AnimationPrevious ) );
-                    StyleOptions options( Hover );
-                    if( !Style::instance().settings().applicationName().useFlatBackground( widget ) )
-                    { options |= Blend; }
+                        Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationPrevious ), rect.x, rect.y, rect.width, rect.height, options, data );
 
-                    Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationPrevious ), rect.x, rect.y, rect.width, rect.height, options, data );
+                    }
 
                 }
 
+                return;
+
             }
+            break;
 
-            return;
+            case Gtk::Detail::ToolBar:
+            {
 
-        } else if( d.isToolBar() ) {
+                // eclipse works ok with animations, though should have flat background
+                if( Style::instance().settings().applicationName().isEclipse() )
+                {
 
-            // eclipse works ok with animations, though should have flat background
-            if( Style::instance().settings().applicationName().isEclipse() )
-            {
+                    draw_animated_button( window, clipRect, widget );
+                    return;
 
-                draw_animated_button( window, clipRect, widget );
-                return;
+                } else if( Style::instance().settings().applicationName().useFlatBackground( widget ) || Gtk::gtk_widget_is_applet( widget )  ) {
 
-            } else if( Style::instance().settings().applicationName().useFlatBackground( widget ) || Gtk::gtk_widget_is_applet( widget )  ) {
+                    return;
 
-                return;
+                } else {
 
-            } else {
+                    Style::instance().renderWindowBackground( window, clipRect, x, y, w, h );
 
-                Style::instance().renderWindowBackground( window, clipRect, x, y, w, h );
+                    // possible groupbox background
+                    if( Gtk::gtk_parent_groupbox( widget ) )
+                    { Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, Blend ); }
 
-                // possible groupbox background
-                if( Gtk::gtk_parent_groupbox( widget ) )
-                { Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, Blend ); }
+                    // also draw possible animated tool button
+                    draw_animated_button( window, clipRect, widget );
+                    return;
 
-                // also draw possible animated tool button
-                draw_animated_button( window, clipRect, widget );
-                return;
+                }
 
             }
+            break;
 
-        } else if( d.isMenu() ) {
-
-            if( GTK_IS_MENU( widget ) && gtk_menu_get_tearoff_state( GTK_MENU( widget ) ) )
+            case Gtk::Detail::Menu:
             {
 
-                if(
-                    Gtk::gdk_window_is_base( window ) &&
-                    !Style::instance().settings().applicationName().isXul( widget ) )
+                if( GTK_IS_MENU( widget ) && gtk_menu_get_tearoff_state( GTK_MENU( widget ) ) )
                 {
-                    BackgroundHints hints( BackgroundGradient );
-                    if( Style::instance().hasBackgroundSurface() ) hints |= BackgroundPixmap;
-                    Style::instance().animations().backgroundHintEngine().registerWidget( widget, hints );
-                }
 
-                Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h );
+                    if(
+                        Gtk::gdk_window_is_base( window ) &&
+                        !Style::instance().settings().applicationName().isXul( widget ) )
+                    {
+                        BackgroundHints hints( BackgroundGradient );
+                        if( Style::instance().hasBackgroundSurface() ) hints |= BackgroundPixmap;
+                        Style::instance().animations().backgroundHintEngine().registerWidget( widget, hints );
+                    }
 
-            } else {
+                    Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h );
 
-                StyleOptions options( Menu );
+                } else {
 
-                // set alpha flag. Special handling is needed for mozilla and openoffice.
-                if( Style::instance().settings().applicationName().isXul( widget ) ||
-                    Style::instance().settings().applicationName().isOpenOffice( widget ) )
-                {
+                    StyleOptions options( Menu );
 
-                    Style::instance().renderMenuBackground( window, clipRect, x, y, w, h, options );
+                    // set alpha flag. Special handling is needed for mozilla and openoffice.
+                    if( Style::instance().settings().applicationName().isXul( widget ) ||
+                        Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                    {
 
-                    // since menus are rendered square anyway, we can set the alpha channel
-                    // based on the screen properties only, in order to prevent ugly shadow to be drawn
-                    if( Gtk::gdk_default_screen_is_composited() ) options |= Alpha;
-                    Style::instance().drawFloatFrame( window, clipRect, x, y, w, h, options );
-                    return;
-                }
+                        Style::instance().renderMenuBackground( window, clipRect, x, y, w, h, options );
 
-                options |= Round;
-                if( Gtk::gtk_widget_has_rgba( widget ) ) options |= Alpha;
+                        // since menus are rendered square anyway, we can set the alpha channel
+                        // based on the screen properties only, in order to prevent ugly shadow to be drawn
+                        if( Gtk::gdk_default_screen_is_composited() ) options |= Alpha;
+                        Style::instance().drawFloatFrame( window, clipRect, x, y, w, h, options );
+                        return;
+                    }
 
-                if( style )
-                { options._customColors.insert( Palette::Window, Gtk::gdk_get_color( style->bg[state] ) ); }
+                    options |= Round;
+                    if( Gtk::gtk_widget_has_rgba( widget ) ) options |= Alpha;
 
-                // add mask if needed
-                if( GTK_IS_MENU(widget) )
-                {
-                    Style::instance().animations().menuItemEngine().registerMenu( widget );
+                    if( style )
+                    { options._customColors.insert( Palette::Window, Gtk::gdk_get_color( style->bg[state] ) ); }
 
-                    WidgetSizeEngine& engine( Style::instance().animations().widgetSizeEngine() );
-                    engine.registerWidget( widget );
-                    if( engine.update( widget ) )
+                    // add mask if needed
+                    if( GTK_IS_MENU(widget) )
                     {
-                        Style::instance().adjustMask( widget, engine.width( widget ), engine.height( widget ), engine.alpha( widget ) );
-                        if( Style::instance().settings().backgroundOpacity() < 255 )
-                        { Style::instance().setWindowBlur( widget, engine.alpha( widget ) ); }
-                    }
-                }
-
-                // if render
-                if( !Style::instance().renderMenuBackground( window, clipRect, x, y, w, h, options ) )
-                { options &= ~Round; }
+                        Style::instance().animations().menuItemEngine().registerMenu( widget );
 
-                Style::instance().drawFloatFrame( window, clipRect, x, y, w, h, options );
+                        WidgetSizeEngine& engine( Style::instance().animations().widgetSizeEngine() );
+                        engine.registerWidget( widget );
+                        if( engine.update( widget ) )
+                        {
+                            unsigned int flags( WidgetSizeEngine::UpdateMask );
+                            if( Style::instance().settings().backgroundOpacity() < 255 ) flags |= WidgetSizeEngine::UpdateBlur;
+                            engine.scheduleUpdate( widget, flags );
+                        }
+                    }
 
-            }
+                    // if render
+                    if( !Style::instance().renderMenuBackground( window, clipRect, x, y, w, h, options ) )
+                    { options &= ~Round; }
 
-            // check animation state
-            if( GTK_IS_MENU( widget ) )
-            {
+                    Style::instance().drawFloatFrame( window, clipRect, x, y, w, h, options );
 
-                MenuStateEngine& engine( Style::instance().animations().menuStateEngine() );
-                engine.registerWidget(widget);
+                }
 
-                if( engine.animatedRectangleIsValid( widget ) )
+                // check animation state
+                if( GTK_IS_MENU( widget ) )
                 {
 
-                    const GdkRectangle& rect( engine.animatedRectangle( widget ) );
-                    Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationCurrent ), rect.x, rect.y, rect.width, rect.height, Hover );
+                    MenuStateEngine& engine( Style::instance().animations().menuStateEngine() );
+                    engine.registerWidget(widget);
 
-                } else if( engine.isLocked( widget ) ) {
+                    if( engine.animatedRectangleIsValid( widget ) )
+                    {
 
-                    const GdkRectangle& rect( engine.rectangle( widget, AnimationCurrent ) );
-                    Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationCurrent ), rect.x, rect.y, rect.width, rect.height, Hover );
+                        const GdkRectangle& rect( engine.animatedRectangle( widget ) );
+                        Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationCurrent ), rect.x, rect.y, rect.width, rect.height, Hover );
 
-               } else if( engine.isAnimated( widget, AnimationPrevious ) ) {
+                    } else if( engine.isLocked( widget ) ) {
 
-                    const AnimationData data( engine.animationData( widget, AnimationPrevious ) );
-                    const GdkRectangle& rect( engine.rectangle( widget, AnimationPrevious ) );
-                    Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationPrevious ), rect.x, rect.y, rect.width, rect.height, Hover, data );
+                        const GdkRectangle& rect( engine.rectangle( widget, AnimationCurrent ) );
+                        Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationCurrent ), rect.x, rect.y, rect.width, rect.height, Hover );
 
-                 }
+                   } else if( engine.isAnimated( widget, AnimationPrevious ) ) {
 
-            }
+                        const AnimationData data( engine.animationData( widget, AnimationPrevious ) );
+                        const GdkRectangle& rect( engine.rectangle( widget, AnimationPrevious ) );
+                        Style::instance().renderMenuItemRect( window, clipRect, engine.widget( widget, AnimationPrevious ), rect.x, rect.y, rect.width, rect.height, Hover, data );
 
+                     }
 
-        } else if( d.isMenuScrollArrow() ) {
+                }
 
-            return;
+            }
+            break;
 
-        } else if( d.isDefaultButton() || d.isScrollBar() || d.isPaned() || d.isHandleBox() ) {
+            case Gtk::Detail::MenuScrollArrowDown:
+            case Gtk::Detail::MenuScrollArrowUp:
+            {
 
-            return;
+                return;
 
-        } else if( d.isDockItem() ) {
+            }
+            break;
 
-            // force window background for dock-items. Fixes inkscape docks
-            Style::instance().renderWindowBackground( window, clipRect, x, y, w, h );
+            case Gtk::Detail::DefaultButton:
+            case Gtk::Detail::HScrollBar:
+            case Gtk::Detail::VScrollBar:
+            case Gtk::Detail::Paned:
+            case Gtk::Detail::HandleBox:
+            case Gtk::Detail::HandleBoxBin:
+            {
 
-        } else if( d.isMenuItem() ) {
+                return;
 
-            if( GTK_IS_MENU_ITEM( widget ) )
-            {
-                GtkWidget* child( gtk_bin_get_child( GTK_BIN( widget ) ) );
-                Style::instance().animations().menuItemEngine().registerWidget( child );
             }
+            break;
 
-            GtkWidget* parent( gtk_widget_get_parent( widget ) );
-            AnimationData data;
-            if( GTK_IS_MENU_BAR( parent ) )
+            case Gtk::Detail::DockItem:
             {
 
-                MenuBarStateEngine& engine = Style::instance().animations().menuBarStateEngine();
-                engine.registerWidget( parent );
-                if( engine.animatedRectangleIsValid( parent ) )
-                {
-                    return;
+                // force window background for dock-items. Fixes inkscape docks
+                Style::instance().renderWindowBackground( window, clipRect, x, y, w, h );
 
-                } else if( engine.widget( parent, AnimationCurrent ) == widget ) {
+            }
+            break;
 
-                    data = engine.animationData( parent, AnimationCurrent );
+            case Gtk::Detail::MenuItem:
+            {
 
+                if( GTK_IS_MENU_ITEM( widget ) )
+                {
+                    GtkWidget* child( gtk_bin_get_child( GTK_BIN( widget ) ) );
+                    Style::instance().animations().menuItemEngine().registerWidget( child );
                 }
 
-            } else if( GTK_IS_MENU( parent ) ) {
-
-                MenuStateEngine& engine = Style::instance().animations().menuStateEngine();
-                engine.registerWidget( parent );
-                if( engine.animatedRectangleIsValid( parent ) )
+                GtkWidget* parent( gtk_widget_get_parent( widget ) );
+                AnimationData data;
+                if( GTK_IS_MENU_BAR( parent ) )
                 {
-                    return;
 
-                } else if( engine.widget( parent, AnimationCurrent ) == widget ) {
+                    MenuBarStateEngine& engine = Style::instance().animations().menuBarStateEngine();
+                    engine.registerWidget( parent );
+                    if( engine.animatedRectangleIsValid( parent ) )
+                    {
+                        return;
 
-                    data = engine.animationData( parent, AnimationCurrent );
+                    } else if( engine.widget( parent, AnimationCurrent ) == widget ) {
 
-                }
+                        data = engine.animationData( parent, AnimationCurrent );
 
-            }
+                    }
 
+                } else if( GTK_IS_MENU( parent ) ) {
 
-            StyleOptions options( widget, state, shadow );
-            if( !Style::instance().settings().applicationName().useFlatBackground( widget ) )
-            { options |= Blend; }
+                    MenuStateEngine& engine = Style::instance().animations().menuStateEngine();
+                    engine.registerWidget( parent );
+                    if( engine.animatedRectangleIsValid( parent ) )
+                    {
+                        return;
 
-            Style::instance().renderMenuItemRect( window, clipRect, widget, x, y, w, h, options, data );
+                    } else if( engine.widget( parent, AnimationCurrent ) == widget ) {
 
-        } else if( d.isTroughAny() && GTK_IS_SCALE( widget ) ) {
+                        data = engine.animationData( parent, AnimationCurrent );
 
-            const bool vertical( Gtk::gtk_widget_is_vertical( widget ) );
-            const int offset( 6 );
-            if( vertical ) {
+                    }
+
+                }
 
-                // TODO: calculate this value from the style "slider-width" property
-                if( d.isTrough() ) Style::instance().renderSliderGroove( window, clipRect, x, y + offset, w, h - 2*offset, Vertical );
-                else if( d.isTroughLower() ) Style::instance().renderSliderGroove( window, clipRect, x, y + offset, w, h, Vertical );
-                else if( d.isTroughUpper() ) Style::instance().renderSliderGroove( window, clipRect, x, y, w, h - offset, Vertical );
 
-            } else {
+                StyleOptions options( widget, state, shadow );
+                if( !Style::instance().settings().applicationName().useFlatBackground( widget ) )
+                { options |= Blend; }
 
-                // TODO: calculate this value from the style "slider-width" property
-                const int offset( 6 );
-                if( d.isTrough() ) Style::instance().renderSliderGroove( window, clipRect, x + offset, y, w - 2*offset, h, StyleOptions() );
-                else if( d.isTroughLower() ) Style::instance().renderSliderGroove( window, clipRect, x + offset, y, w, h, StyleOptions() );
-                else if( d.isTroughUpper() ) Style::instance().renderSliderGroove( window, clipRect, x, y, w - offset, h, StyleOptions() );
+                Style::instance().renderMenuItemRect( window, clipRect, widget, x, y, w, h, options, data );
 
             }
+            break;
 
-        } else if( d.isTrough() && shadow == GTK_SHADOW_IN ) {
-
-            if( GTK_IS_PROGRESS_BAR( widget ) )
+            case Gtk::Detail::Trough:
+            case Gtk::Detail::TroughLower:
+            case Gtk::Detail::TroughUpper:
             {
 
-                if( !Style::instance().settings().applicationName().isXul( widget ) &&
-                    !Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                if( GTK_IS_SCALE( widget ) )
                 {
-                    /*
-                    need to call the parent style implementation here,
-                    otherwise some uninitialized pixels are present.
-                    Not sure why
-                    */
-                    StyleWrapper::parentClass()->draw_box( style, window, state, shadow, clipRect, widget, detail, x, y, w, h );
 
-                    if( !Gtk::gtk_widget_is_applet( widget ) )
-                    {
+                    const bool vertical( Gtk::gtk_widget_is_vertical( widget ) );
+                    const int offset( 6 );
+                    if( vertical ) {
 
-                        Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h );
+                        // TODO: calculate this value from the style "slider-width" property
+                        if( d.isTrough() ) Style::instance().renderSliderGroove( window, clipRect, x, y + offset, w, h - 2*offset, Vertical );
+                        else if( d.isTroughLower() ) Style::instance().renderSliderGroove( window, clipRect, x, y + offset, w, h, Vertical );
+                        else if( d.isTroughUpper() ) Style::instance().renderSliderGroove( window, clipRect, x, y, w, h - offset, Vertical );
 
-                        // possible groupbox background
-                        if( Gtk::gtk_parent_groupbox( widget ) )
-                        { Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, Blend ); }
+                    } else {
+
+                        // TODO: calculate this value from the style "slider-width" property
+                        const int offset( 6 );
+                        if( d.isTrough() ) Style::instance().renderSliderGroove( window, clipRect, x + offset, y, w - 2*offset, h, StyleOptions() );
+                        else if( d.isTroughLower() ) Style::instance().renderSliderGroove( window, clipRect, x + offset, y, w, h, StyleOptions() );
+                        else if( d.isTroughUpper() ) Style::instance().renderSliderGroove( window, clipRect, x, y, w - offset, h, StyleOptions() );
 
                     }
-                }
 
-                StyleOptions options;
-                if( Gtk::gtk_widget_is_vertical( widget ) ) options |= Vertical;
-                Style::instance().renderProgressBarHole( window, clipRect, x, y, w, h, options );
+                } else if( d.isTrough() && shadow == GTK_SHADOW_IN ) {
 
-            } else if( GTK_IS_VSCROLLBAR( widget ) ) {
+                    if( GTK_IS_PROGRESS_BAR( widget ) )
+                    {
 
-                if(Style::instance().settings().applicationName().isOpenOffice( widget ) )
-                {
-                    // adjust scrollbar hole since it has wrong geometry in OOo
-                    y-=1;
-                }
+                        if( !Style::instance().settings().applicationName().isXul( widget ) &&
+                            !Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                        {
+                            /*
+                            need to call the parent style implementation here,
+                            otherwise some uninitialized pixels are present.
+                            Not sure why
+                            */
+                            StyleWrapper::parentClass()->draw_box( style, window, state, shadow, clipRect, widget, detail, x, y, w, h );
+
+                            if( !Gtk::gtk_widget_is_applet( widget ) )
+                            {
 
+                                Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h );
 
-                Style::instance().adjustScrollBarHole( x, y, w, h, Vertical );
-                Style::instance().renderScrollBarHole( window, clipRect, x, y+1, w-1, h-1, Vertical );
+                                // possible groupbox background
+                                if( Gtk::gtk_parent_groupbox( widget ) )
+                                { Style::instance().renderGroupBoxBackground( window, widget, clipRect, x, y, w, h, Blend ); }
 
-            } else if( GTK_IS_HSCROLLBAR( widget ) ) {
+                            }
+                        }
 
-                if(Style::instance().settings().applicationName().isOpenOffice( widget ) )
-                {
-                    // adjust scrollbar hole since it has wrong geometry in OOo
-                    x-=2; w+=1;
-                }
+                        StyleOptions options;
+                        if( Gtk::gtk_widget_is_vertical( widget ) ) options |= Vertical;
+                        Style::instance().renderProgressBarHole( window, clipRect, x, y, w, h, options );
 
-                Style::instance().adjustScrollBarHole( x, y, w, h, StyleOptions() );
-                Style::instance().renderScrollBarHole( window, clipRect, x+1, y, w-2, h-1, StyleOptions() );
+                    } else if( GTK_IS_VSCROLLBAR( widget ) ) {
 
-            }
+                        if(Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                        {
+                            // adjust scrollbar hole since it has wrong geometry in OOo
+                            y-=1;
+                        }
 
-        } else if( d.isSpinButton()) {
 
-            StyleOptions options( widget, state, shadow );
-            options |= Blend;
+                        Style::instance().adjustScrollBarHole( x, y, w, h, Vertical );
+                        Style::instance().renderScrollBarHole( window, clipRect, x, y+1, w-1, h-1, Vertical );
+
+                    } else if( GTK_IS_HSCROLLBAR( widget ) ) {
+
+                        if(Style::instance().settings().applicationName().isOpenOffice( widget ) )
+                        {
+                            // adjust scrollbar hole since it has wrong geometry in OOo
+                            x-=2; w+=1;
+                        }
+
+                        Style::instance().adjustScrollBarHole( x, y, w, h, StyleOptions() );
+                        Style::instance().renderScrollBarHole( window, clipRect, x+1, y, w-2, h-1, StyleOptions() );
+
+                    }
+
+                } else {
+
+                    StyleWrapper::parentClass()->draw_box( style, window, state,
+                        shadow, clipRect, widget, detail,
+                        x, y, w, h );
+
+                }
+
+            }
+            break;
 
-            if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
+            case Gtk::Detail::SpinButton:
             {
-                // Do nothing for openoffice
-                return;
-            } else {
 
-                options |= NoFill;
-                ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[gtk_widget_get_state(widget)] ) );
-                if( Style::instance().settings().applicationName().isXul( widget ) )
+                StyleOptions options( widget, state, shadow );
+                options |= Blend;
+
+                if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
                 {
+                    // Do nothing for openoffice
+                    return;
+                } else {
 
-                    /*
-                    for firefox on has to mask out the corners manually,
-                    because renderholebackground fails
-                    */
-                    Cairo::Context context( window, clipRect );
-                    cairo_rounded_rectangle( context, x-4, y+2, w+3, h-4, 2, CornersRight );
-                    cairo_set_source( context, background );
-                    cairo_fill( context );
+                    options |= NoFill;
+                    ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[gtk_widget_get_state(widget)] ) );
+                    if( Style::instance().settings().applicationName().isXul( widget ) )
+                    {
 
-                    x += 1;
-                    w += 2;
+                        /*
+                        for firefox on has to mask out the corners manually,
+                        because renderholebackground fails
+                        */
+                        Cairo::Context context( window, clipRect );
+                        cairo_rounded_rectangle( context, x-4, y+2, w+3, h-4, 2, CornersRight );
+                        cairo_set_source( context, background );
+                        cairo_fill( context );
 
-                } else Style::instance().fill( window, clipRect, x, y, w, h, background );
+                        x += 1;
+                        w += 2;
 
-            }
+                    } else Style::instance().fill( window, clipRect, x, y, w, h, background );
 
-            if(
-                Style::instance().animations().hoverEngine().contains( widget ) &&
-                Style::instance().animations().hoverEngine().hovered( widget ) )
-            { options |= Hover; }
+                }
 
-            TileSet::Tiles tiles( TileSet::Ring);
-            const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
+                if(
+                    Style::instance().animations().hoverEngine().contains( widget ) &&
+                    Style::instance().animations().hoverEngine().hovered( widget ) )
+                { options |= Hover; }
 
-            const int sideMargin( std::max( 0, style->xthickness - 2 ) );
-            if( Gtk::gtk_widget_layout_is_reversed( widget ) )
-            {
+                TileSet::Tiles tiles( TileSet::Ring);
+                const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
 
-                tiles &= ~TileSet::Right;
+                const int sideMargin( std::max( 0, style->xthickness - 2 ) );
+                if( Gtk::gtk_widget_layout_is_reversed( widget ) )
+                {
 
-                if( !Style::instance().settings().applicationName().isOpenOffice( widget ) &&
-                    !Style::instance().settings().applicationName().isXul( widget ) )
-                { Style::instance().renderHoleBackground( window, widget, clipRect, x-1, y-1, w+6, h+2, tiles, sideMargin ); }
+                    tiles &= ~TileSet::Right;
 
-                // shrink spinbox entry hole by 3px on right side
-                x += sideMargin;
-                w -= sideMargin;
-                Style::instance().renderHole( window, clipRect, x-1, y-1, w+8, h+2, options, data, tiles );
+                    if( !Style::instance().settings().applicationName().isOpenOffice( widget ) &&
+                        !Style::instance().settings().applicationName().isXul( widget ) )
+                    { Style::instance().renderHoleBackground( window, widget, clipRect, x-1, y-1, w+6, h+2, tiles, sideMargin ); }
 
-            } else {
+                    // shrink spinbox entry hole by 3px on right side
+                    x += sideMargin;
+                    w -= sideMargin;
+                    Style::instance().renderHole( window, clipRect, x-1, y-1, w+8, h+2, options, data, tiles );
 
-                tiles &= ~TileSet::Left;
+                } else {
 
-                if( !Style::instance().settings().applicationName().isOpenOffice( widget ) &&
-                    !Style::instance().settings().applicationName().isXul( widget ) )
-                { Style::instance().renderHoleBackground( window, widget, clipRect, x-5, y-1, w+6, h+2, tiles, sideMargin ); }
+                    tiles &= ~TileSet::Left;
 
-                // shrink spinbox entry hole by 3px on right side
-                w -= sideMargin;
-                Style::instance().renderHole( window, clipRect, x-7, y-1, w+8, h+2, options, data, tiles );
+                    if( !Style::instance().settings().applicationName().isOpenOffice( widget ) &&
+                        !Style::instance().settings().applicationName().isXul( widget ) )
+                    { Style::instance().renderHoleBackground( window, widget, clipRect, x-5, y-1, w+6, h+2, tiles, sideMargin ); }
 
-            }
+                    // shrink spinbox entry hole by 3px on right side
+                    w -= sideMargin;
+                    Style::instance().renderHole( window, clipRect, x-7, y-1, w+8, h+2, options, data, tiles );
 
+                }
 
-        } else if( d.isSpinButtonUp() || d.isSpinButtonDown() )
-        {
+            }
+            break;
 
-            if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
+            case Gtk::Detail::SpinButtonDown:
+            case Gtk::Detail::SpinButtonUp:
             {
-                if(state==GTK_STATE_ACTIVE)
-                    state=GTK_STATE_NORMAL;
-                ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[state] ) );
-                Cairo::Context context( window, clipRect );
-                StyleOptions options( NoFill );
-                options|=Blend;
-                TileSet::Tiles tiles( TileSet::Ring );
-                tiles &= ~TileSet::Left;
+
+                if( Style::instance().settings().applicationName().isOpenOffice( widget ) )
                 {
-                    int W(w-4), Y(y),H(h);
-                    if(d.isSpinButtonUp())
-                    {
-                        tiles &= ~TileSet::Bottom;
-                        Y+=1;
-                    }
-                    else
+                    if(state==GTK_STATE_ACTIVE)
+                        state=GTK_STATE_NORMAL;
+                    ColorUtils::Rgba background( Gtk::gdk_get_color( style->base[state] ) );
+                    Cairo::Context context( window, clipRect );
+                    StyleOptions options( NoFill );
+                    options|=Blend;
+                    TileSet::Tiles tiles( TileSet::Ring );
+                    tiles &= ~TileSet::Left;
                     {
-                        tiles &= ~TileSet::Top;
-                        H-=2;
+                        int W(w-4), Y(y),H(h);
+                        if(d.isSpinButtonUp())
+                        {
+                            tiles &= ~TileSet::Bottom;
+                            Y+=1;
+                        }
+                        else
+                        {
+                            tiles &= ~TileSet::Top;
+                            H-=2;
+                        }
+
+                        cairo_rounded_rectangle( context, x, Y, W, H, 2, CornersRight );
+                        cairo_set_source( context, background );
+                        cairo_fill( context );
                     }
 
-                    cairo_rounded_rectangle( context, x, Y, W, H, 2, CornersRight );
-                    cairo_set_source( context, background );
-                    cairo_fill( context );
+                    const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
+                    if(d.isSpinButtonUp())
+                        Style::instance().renderHole( window, clipRect, x-7, y, w+5, h+6, options, data, tiles );
+                    else
+                        Style::instance().renderHole( window, clipRect, x-6, y-7, w+4, h+7, options, data, tiles );
+                    return;
                 }
 
-                const AnimationData data( Style::instance().animations().widgetStateEngine().get( widget, options, AnimationHover|AnimationFocus, AnimationFocus ) );
-                if(d.isSpinButtonUp())
-                    Style::instance().renderHole( window, clipRect, x-7, y, w+5, h+6, options, data, tiles );
-                else
-                    Style::instance().renderHole( window, clipRect, x-6, y-7, w+4, h+7, options, data, tiles );
-                return;
             }
+            break;
 
+            case Gtk::Detail::Bar:
+            {
 
-        } else if( d.isSpinButtonArrow() ) {
+                StyleOptions options( widget, state, shadow );
+                if(GTK_IS_PROGRESS_BAR(widget))
+                {
 
-            return;
+                    // active state must be set by hand cause it is not set by gtk
+                    if( !gtk_widget_is_sensitive( widget ) )
+                    { options |= Disabled; }
 
-        } else if( d.isBar() ) {
+                    // get orientation
+                    if( Gtk::gtk_widget_is_vertical( widget ) )
+                    { options |= Vertical; }
 
-            StyleOptions options( widget, state, shadow );
-            if(GTK_IS_PROGRESS_BAR(widget))
-            {
+                    /*
+                    need to adjust rect and clip for altered x/y thickness
+                    because gtk passes it to the handle and not to the hole
+                    */
+                    const int delta_x = 1 - style->xthickness;
+                    const int delta_y = -style->ythickness;
+                    x += delta_x; w -= 2*delta_x;
+                    y += delta_y; h -= 2*delta_y;
 
-                // active state must be set by hand cause it is not set by gtk
-                if( !gtk_widget_is_sensitive( widget ) )
-                { options |= Disabled; }
+                    if( clipRect )
+                    {
+                        clipRect->x += delta_x; clipRect->width -= 2*delta_x;
+                        clipRect->y += delta_y; clipRect->height -= 2*delta_y;
+                    }
 
-                // get orientation
-                if( Gtk::gtk_widget_is_vertical( widget ) )
-                { options |= Vertical; }
+                    if(Style::instance().settings().applicationName().isOpenOffice())
+                    {
+                        ++x;
+                        w-=2;
+                    }
+                    // need to adjust rect and clip to handle unexpected x/y thickness values
+                    Style::instance().renderProgressBarHandle( window, clipRect, x, y, w, h, options );
 
-                /*
-                need to adjust rect and clip for altered x/y thickness
-                because gtk passes it to the handle and not to the hole
-                */
-                const int delta_x = 1 - style->xthickness;
-                const int delta_y = -style->ythickness;
-                x += delta_x; w -= 2*delta_x;
-                y += delta_y; h -= 2*delta_y;
+                } else {
 
-                if( clipRect )
-                {
-                    clipRect->x += delta_x; clipRect->width -= 2*delta_x;
-                    clipRect->y += delta_y; clipRect->height -= 2*delta_y;
-                }
+                    // most likely it's progressbar in the list
+                    // FIXME: is it always the case ? Should we check on TREE_VIEW, CELL_VIEW, like done with scrollbar hole ?
+                    Style::instance().renderProgressBarHandle( window, clipRect, x-1, y, w+1, h, options );
 
-                if(Style::instance().settings().applicationName().isOpenOffice())
-                {
-                    ++x;
-                    w-=2;
                 }
-                // need to adjust rect and clip to handle unexpected x/y thickness values
-                Style::instance().renderProgressBarHandle( window, clipRect, x, y, w, h, options );
 
-            } else {
+                return;
+
+            }
+            break;
+
+            case Gtk::Detail::EntryProgress:
+            {
 
-                // most likely it's progressbar in the list
-                // FIXME: is it always the case ? Should we check on TREE_VIEW, CELL_VIEW, like done with scrollbar hole ?
-                Style::instance().renderProgressBarHandle( window, clipRect, x-1, y, w+1, h, options );
+                StyleOptions options( widget, state, shadow );
+                Style::instance().renderProgressBarHandle( window, clipRect, x-2, y-1, w+4, h+2, options );
 
             }
+            break;
 
-            return;
+            case Gtk::Detail::TroughFillLevel:
+            {
+
+                return;
 
-        } else if( d.isEntryProgress() ) {
+            }
+            break;
 
-            StyleOptions options( widget, state, shadow );
-            Style::instance().renderProgressBarHandle( window, clipRect, x-2, y-1, w+4, h+2, options );
+            case Gtk::Detail::HRuler:
+            case Gtk::Detail::VRuler:
+            {
 
-        } else if( d.isTroughFillLevel () ) {
+                Style::instance().renderWindowBackground(window,widget,clipRect,x,y,w,h);
 
-            return;
+            }
+            break;
 
-        } else if( d.isRuler() ) {
+            default:
+            {
 
-            Style::instance().renderWindowBackground(window,widget,clipRect,x,y,w,h);
+                StyleWrapper::parentClass()->draw_box( style, window, state,
+                    shadow, clipRect, widget, detail,
+                    x, y, w, h );
 
-        } else {
+            }
+            break;
 
-            StyleWrapper::parentClass()->draw_box( style, window, state,
-                shadow, clipRect, widget, detail,
-                x, y, w, h );
         }
 
     }
@@ -1719,7 +1844,7 @@ namespace Oxygen
             WidgetSizeEngine& engine( Style::instance().animations().widgetSizeEngine() );
             engine.registerWidget( parent );
             const WidgetSizeData::ChangedFlags changedFlags( engine.update( parent ) );
-            if( changedFlags ) Style::instance().adjustMask( parent, engine.width( parent ), engine.height( parent ), engine.alpha( parent ) );
+            if( changedFlags ) engine.scheduleUpdate( parent, WidgetSizeEngine::UpdateMask );
 
             #if !ENABLE_INNER_SHADOWS_HACK
             if( changedFlags & WidgetSizeData::SizeChanged )
@@ -1732,13 +1857,12 @@ namespace Oxygen
                     // offset is needed to make combobox list border 3px wide instead of default 2
                     // additional pixel is for ugly shadow
                     const gint offset( options&Alpha ? 0:1 );
-                    GdkPixmap* mask( Style::instance().helper().roundMask(
+                    const GdkRegion* region( Style::instance().helper().roundRegion(
                         allocation.width - 2*offset,
                         allocation.height - 2*offset,
                         3 ) );
 
-                    gdk_window_shape_combine_mask( gtk_widget_get_window( child ), mask, offset, offset );
-                    gdk_pixmap_unref( mask );
+                    gdk_window_shape_combine_region( gtk_widget_get_window( child ), region, offset, offset );
                 }
             }
             #endif
@@ -1776,7 +1900,7 @@ namespace Oxygen
             WidgetSizeEngine& engine( Style::instance().animations().widgetSizeEngine() );
             engine.registerWidget( parent );
             if( engine.update(parent) )
-            { Style::instance().adjustMask( parent, engine.width( parent ), engine.height( parent ), engine.alpha( parent ) ); }
+            { engine.scheduleUpdate( parent, WidgetSizeEngine::UpdateMask ); }
 
             // menu background and float frame
             Style::instance().renderMenuBackground( window, clipRect, x, y, w, h, options );
@@ -3191,7 +3315,7 @@ namespace Oxygen
                 Style::instance().animations().tabWidgetEngine().registerWidget( widget );
 
                 // get current tab, update tabRect and see if current tab is hovered
-                const int tabIndex( Gtk::gtk_notebook_find_tab( widget, x+w/2, y+h/2 ) );
+                const int tabIndex( Style::instance().animations().tabWidgetEngine().findTab( widget, x+w/2, y+h/2 ) );
                 Style::instance().animations().tabWidgetEngine().updateTabRect( widget, tabIndex, x, y, w, h );
                 if( tabIndex == Style::instance().animations().tabWidgetEngine().hoveredTab( widget ) )
                 { options |= Hover; }
@@ -3430,12 +3554,13 @@ namespace Oxygen
 
             Style::instance().animations().panedEngine().registerWidget( widget );
 
+            static const Gtk::TypeName pizzaType( "GtkPizza" );
             StyleOptions options( widget, state, shadow );
             if( GTK_IS_VPANED( widget ) )
             {
                 options |= Vertical;
 
-            } else if( Gtk::g_object_is_a( G_OBJECT( widget ), "GtkPizza" ) ) {
+            } else if( Gtk::g_object_is_a( G_OBJECT( widget ), pizzaType ) ) {
 
                 Style::instance().renderWindowBackground( window, widget, clipRect, x, y, w, h );
                 if( w>h ) options |= Vertical;
@@ -25,12 +25,14 @@
 #include "oxygentheme.h"
 
 #include "config.h"
+#include "oxygencairocontextcache.h"
 #include "oxygenrcstyle.h"
 #include "oxygenstyle.h"
 #include "oxygenstylewrapper.h"
 #include "oxygenwindecooptions.h"
 #include "oxygenwindowshadow.h"
 #include "oxygentimelineserver.h"
+#include "oxygenx11atoms.h"
 
 #include <gmodule.h>
 #include <gtk/gtk.h>
@@ -79,7 +81,13 @@ void theme_exit( void )
 
     // delete style instance
     delete &Oxygen::Style::instance();
+    Oxygen::ApplicationName::disconnectHooks();
     delete &Oxygen::TimeLineServer::instance();
+    delete &Oxygen::Cairo::ContextCache::instance();
+
+    #ifdef GDK_WINDOWING_X11
+    delete &Oxygen::X11Atoms::instance();
+    #endif
 
 }
 
@@ -110,6 +118,10 @@ void drawWindecoButton(cairo_t* context, unsigned long buttonType,unsigned long
         (Oxygen::WinDeco::ButtonStatus)buttonState, (Oxygen::WinDeco::Options) windowState, x, y, w, h);
 }
 
+//_________________________________________________
+void drawWindecoButtons(cairo_t* context, const Oxygen::WinDeco::ButtonData* buttons, unsigned long count, unsigned long windowState)
+{ Oxygen::Style::instance().drawWindecoButtons( context, buttons, count, (Oxygen::WinDeco::Options) windowState ); }
+
 //_________________________________________________
 void drawWindecoShapeMask(cairo_t* context, unsigned long options, gint x,gint y,gint w,gint h)
 {
@@ -136,4 +148,4 @@ gint getWindecoButtonSize(unsigned long buttonType)
 
 //_________________________________________________
 unsigned long getWindecoABIVersion(void)
-{ return 0x3; }
+{ return 0x4; }
@@ -25,6 +25,8 @@
 * MA 02110-1301, USA.
 */
 
+#include "oxygenwindecobutton.h"
+
 #include <gtk/gtk.h>
 
 //!@name external 'c' methods, expected by gtk
@@ -37,6 +39,7 @@ extern "C" G_MODULE_EXPORT const gchar* g_module_check_init( GModule* );
 // exports for WM theming
 extern "C" G_MODULE_EXPORT void drawWindowDecoration(cairo_t*, unsigned long,gint,gint,gint,gint,const gchar**,gint,gint);
 extern "C" G_MODULE_EXPORT void drawWindecoButton(cairo_t*, unsigned long,unsigned long, unsigned long,gint,gint,gint,gint);
+extern "C" G_MODULE_EXPORT void drawWindecoButtons(cairo_t*, const Oxygen::WinDeco::ButtonData*, unsigned long, unsigned long);
 extern "C" G_MODULE_EXPORT void drawWindecoShapeMask(cairo_t*, unsigned long,gint,gint,gint,gint);
 extern "C" G_MODULE_EXPORT void drawWindowShadow(cairo_t*, unsigned long options, gint x, gint y, gint w, gint h);
 extern "C" G_MODULE_EXPORT gint getWindecoMetric(unsigned long);
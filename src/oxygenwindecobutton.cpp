@@ -30,8 +30,29 @@
 namespace Oxygen
 {
 
+    //________________________________________________________________________________
+    WinDeco::ButtonPalette::ButtonPalette( const QtSettings& settings ):
+        _base( settings.palette().color( Palette::Active, Palette::Window ) ),
+        _disabledBase( settings.palette().color( Palette::Disabled, Palette::Window ) ),
+        _shadow( ColorUtils::shadowColor( _base ) ),
+        _disabledShadow( ColorUtils::shadowColor( _disabledBase ) ),
+        _light( ColorUtils::lightColor( _base ) ),
+        _disabledLight( ColorUtils::lightColor( _disabledBase ) ),
+        _text( settings.palette().color( Palette::WindowText ) ),
+        _disabledText( settings.palette().color( Palette::Disabled, Palette::WindowText ) ),
+        _negativeText( settings.palette().color( Palette::NegativeText ) ),
+        _hover( settings.palette().color( Palette::Hover ) )
+    {}
+
     //________________________________________________________________________________
     void WinDeco::Button::render( cairo_t* context, gint x, gint y, gint w, gint h ) const
+    {
+        if( _type==ButtonMenu ) return;
+        render( context, x, y, w, h, ButtonPalette( settings() ) );
+    }
+
+    //________________________________________________________________________________
+    void WinDeco::Button::render( cairo_t* context, gint x, gint y, gint w, gint h, const ButtonPalette& palette ) const
     {
         if( _type==ButtonMenu )
         {
@@ -42,17 +63,16 @@ namespace Oxygen
         cairo_save( context );
         cairo_translate( context, x, y );
 
-        const ColorUtils::Rgba base( settings().palette().color( _state == Disabled ? Palette::Disabled : Palette::Active, Palette::Window ) );
-        ColorUtils::Rgba glow( settings().palette().color( Palette::WindowText ) );
+        const bool disabled( _state == Disabled );
+        const ColorUtils::Rgba& base( palette.base( disabled ) );
+        ColorUtils::Rgba glow( palette.text() );
         ColorUtils::Rgba icon(glow);
         const double scale( (21.0*settings().buttonSize())/22.0 );
 
         // draw shadow
         if(_state==Hovered||_state==Pressed)
         {
-            glow=(_type==ButtonClose)?
-                ColorUtils::Rgba( settings().palette().color( Palette::NegativeText ) ):
-                ColorUtils::Rgba( settings().palette().color( Palette::Hover ) );
+            glow=(_type==ButtonClose) ? palette.negativeText():palette.hover();
             icon=glow;
         } else {
             glow=ColorUtils::Rgba(0,0,0);
@@ -61,7 +81,7 @@ namespace Oxygen
         cairo_save(context);
         cairo_scale(context,int(scale)/21.,int(scale)/21.);
         cairo_translate(context,0,-1.4);
-        _helper.drawShadow(context,ColorUtils::shadowColor(base),21);
+        _helper.drawShadow(context,palette.shadow( disabled ),21);
         if(_state==Hovered||_state==Pressed)
             _helper.drawOuterGlow(context,glow,21);
         cairo_restore(context);
@@ -79,15 +99,12 @@ namespace Oxygen
         cairo_set_line_join( context, CAIRO_LINE_JOIN_ROUND );
 
         cairo_scale( context, double(w)/22.0, double(h)/22.0 );
-        Oxygen::cairo_set_source( context, ColorUtils::lightColor( base ) );
+        Oxygen::cairo_set_source( context, palette.light( disabled ) );
         drawIcon( context, w, h );
 
         cairo_translate( context, 0, -1.5 );
 
-        if(_state==Disabled)
-        {
-            icon=ColorUtils::Rgba( settings().palette().color( Palette::Disabled, Palette::WindowText ) );
-        }
+        if( disabled ) icon=palette.disabledText();
         cairo_set_source( context, icon );
 
         drawIcon( context, w, h );
@@ -22,6 +22,8 @@
 */
 
 #include "oxygencairocontext.h"
+#include "oxygenrgba.h"
+
 namespace Oxygen
 {
 
@@ -60,6 +62,74 @@ namespace Oxygen
             ButtonTypeCount
         };
 
+        //! button geometry and state, for batch rendering
+        /*!
+        plain structure, shared with the window manager through drawWindecoButtons.
+        Fields use the same types as the arguments of drawWindecoButton
+        */
+        struct ButtonData
+        {
+            unsigned long type;
+            unsigned long state;
+            gint x;
+            gint y;
+            gint w;
+            gint h;
+        };
+
+        //! colors used to render buttons
+        /*! computed once from the settings palette, and shared by all buttons of a titlebar */
+        class ButtonPalette
+        {
+
+            public:
+
+            //! constructor
+            explicit ButtonPalette( const QtSettings& );
+
+            //! base color
+            const ColorUtils::Rgba& base( bool disabled ) const
+            { return disabled ? _disabledBase:_base; }
+
+            //! shadow color
+            const ColorUtils::Rgba& shadow( bool disabled ) const
+            { return disabled ? _disabledShadow:_shadow; }
+
+            //! light color
+            const ColorUtils::Rgba& light( bool disabled ) const
+            { return disabled ? _disabledLight:_light; }
+
+            //! text
+            const ColorUtils::Rgba& text( void ) const
+            { return _text; }
+
+            //! disabled text
+            const ColorUtils::Rgba& disabledText( void ) const
+            { return _disabledText; }
+
+            //! negative text, for close button glow
+            const ColorUtils::Rgba& negativeText( void ) const
+            { return _negativeText; }
+
+            //! hover
+            const ColorUtils::Rgba& hover( void ) const
+            { return _hover; }
+
+            private:
+
+            ColorUtils::Rgba _base;
+            ColorUtils::Rgba _disabledBase;
+            ColorUtils::Rgba _shadow;
+            ColorUtils::Rgba _disabledShadow;
+            ColorUtils::Rgba _light;
+            ColorUtils::Rgba _disabledLight;
+            ColorUtils::Rgba _text;
+            ColorUtils::Rgba _disabledText;
+            ColorUtils::Rgba _negativeText;
+            ColorUtils::Rgba _hover;
+
+        };
+
         //! window decoration button
         class Button
         {
@@ -85,6 +155,9 @@ namespace Oxygen
             //! render
             void render( cairo_t*, gint x, gint y, gint w, gint h ) const;
 
+            //! render, using precomputed colors
+            void render( cairo_t*, gint x, gint y, gint w, gint h, const ButtonPalette& ) const;
+
             protected:
 
             //! icon
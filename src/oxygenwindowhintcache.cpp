@@ -0,0 +1,129 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenwindowhintcache.h"
+#include "config.h"
+
+#include <iostream>
+
+#ifdef GDK_WINDOWING_X11
+#include <gdk/gdkx.h>
+#include <X11/Xatom.h>
+#endif
+
+namespace Oxygen
+{
+
+    #ifdef GDK_WINDOWING_X11
+
+    //____________________________________________________________________
+    WindowHintCache::~WindowHintCache( void )
+    {
+        if( _filterInstalled )
+        { gdk_window_remove_filter( 0L, (GdkFilterFunc)eventFilter, this ); }
+    }
+
+    //____________________________________________________________________
+    bool WindowHintCache::hasBackgroundGradient( Display* display, Window window, Atom atom )
+    {
+
+        // install filter, to get notified of property changes
+        if( !_filterInstalled )
+        {
+            gdk_window_add_filter( 0L, (GdkFilterFunc)eventFilter, this );
+            _filterInstalled = true;
+        }
+
+        // cached hints are only valid for a given atom
+        if( atom != _backgroundGradientAtom )
+        {
+            _backgroundGradients.clear();
+            _backgroundGradientAtom = atom;
+        }
+
+        // check cache
+        HintMap::const_iterator iter( _backgroundGradients.find( window ) );
+        if( iter != _backgroundGradients.end() ) return iter->second;
+
+        /*
+        select property and structure changes on the client window, so that cached value gets invalidated.
+        Masks are added to the ones already selected by this connection, since XSelectInput replaces them.
+        Errors are trapped since the window is not ours and might be destroyed at any time
+        */
+        gdk_error_trap_push();
+        XWindowAttributes attributes;
+        if( XGetWindowAttributes( display, window, &attributes ) )
+        { XSelectInput( display, window, attributes.your_event_mask|PropertyChangeMask|StructureNotifyMask ); }
+
+        // read property
+        Atom typeRet;
+        int formatRet;
+        unsigned long itemsRet;
+        unsigned long afterRet;
+        unsigned char *data = 0;
+
+        const bool out(
+            XGetWindowProperty( display, window, atom, 0, G_MAXLONG, False,
+            XA_CARDINAL, &typeRet, &formatRet, &itemsRet, &afterRet, &data) == Success
+            && itemsRet == 1
+            && formatRet == 32 );
+
+        if( data ) XFree( data );
+
+        // do not store anything if window is gone
+        if( gdk_error_trap_pop() ) return out;
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::WindowHintCache::hasBackgroundGradient - window: " << window << " hint: " << out << std::endl;
+        #endif
+
+        // store
+        if( _backgroundGradients.size() >= MaxSize ) _backgroundGradients.clear();
+        _backgroundGradients.insert( std::make_pair( window, out ) );
+        return out;
+
+    }
+
+    //____________________________________________________________________
+    GdkFilterReturn WindowHintCache::eventFilter( GdkXEvent* gdkXEvent, GdkEvent*, gpointer pointer )
+    {
+
+        WindowHintCache& cache( *static_cast<WindowHintCache*>( pointer ) );
+        if( cache._backgroundGradients.empty() ) return GDK_FILTER_CONTINUE;
+
+        const XEvent* xEvent( static_cast<XEvent*>( gdkXEvent ) );
+        if( xEvent->type == PropertyNotify && xEvent->xproperty.atom == cache._backgroundGradientAtom )
+        {
+
+            cache._backgroundGradients.erase( xEvent->xproperty.window );
+
+        } else if( xEvent->type == DestroyNotify ) {
+
+            cache._backgroundGradients.erase( xEvent->xdestroywindow.window );
+
+        }
+
+        return GDK_FILTER_CONTINUE;
+
+    }
+
+    #endif
+
+}
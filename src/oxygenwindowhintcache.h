@@ -0,0 +1,90 @@
+#ifndef oxygenwindowhintcache_h
+#define oxygenwindowhintcache_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include <gdk/gdk.h>
+#include <map>
+
+#ifdef GDK_WINDOWING_X11
+#include <X11/Xdefs.h>
+#include <X11/Xlib.h>
+#endif
+
+namespace Oxygen
+{
+
+    #ifdef GDK_WINDOWING_X11
+
+    //! caches background hints set by client windows, for window decoration rendering
+    /*!
+    the hint is read once per client window. Property and structure changes are selected on the window
+    when first cached, and the value is invalidated when a PropertyNotify event is received for the hint atom,
+    or when the window gets destroyed, so that decoration repaints do not require any X round trip.
+    */
+    class WindowHintCache
+    {
+
+        public:
+
+        //! constructor
+        WindowHintCache( void ):
+            _filterInstalled( false ),
+            _backgroundGradientAtom( None )
+        {}
+
+        //! destructor
+        virtual ~WindowHintCache( void );
+
+        //! true if background gradient hint is set on window
+        bool hasBackgroundGradient( Display*, Window, Atom );
+
+        //! clear
+        void clear( void )
+        { _backgroundGradients.clear(); }
+
+        protected:
+
+        //! event filter, to invalidate cached hints
+        static GdkFilterReturn eventFilter( GdkXEvent*, GdkEvent*, gpointer );
+
+        private:
+
+        //! max number of cached windows
+        /*! used as a safeguard, in case window destruction is not notified */
+        enum { MaxSize = 256 };
+
+        //! true when event filter is installed
+        bool _filterInstalled;
+
+        //! hint atom
+        Atom _backgroundGradientAtom;
+
+        //! cached background gradient hints, per window
+        typedef std::map<Window, bool> HintMap;
+        HintMap _backgroundGradients;
+
+    };
+
+    #endif
+
+}
+
+#endif
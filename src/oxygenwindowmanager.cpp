@@ -26,6 +26,7 @@
 */
 
 #include "oxygenwindowmanager.h"
+#include "oxygengtktypeflags.h"
 #include "oxygenpropertynames.h"
 #include "oxygenstyle.h"
 #include "config.h"
@@ -358,18 +359,19 @@ namespace Oxygen
         GtkWidget* widget( GTK_WIDGET( g_value_get_object( params ) ) );
         if( !GTK_IS_WIDGET( widget ) ) return FALSE;
 
+        // check widget type
+        const unsigned int flags( Gtk::TypeFlags::get( G_OBJECT_TYPE( widget ) ) );
+        if( !( flags & ( Gtk::TypeFlags::WindowManagerWidget|Gtk::TypeFlags::Button ) ) ) return TRUE;
+
         // never register widgets that are possibly applets
         if( Gtk::gtk_widget_is_applet( widget ) ) return TRUE;
 
         // cast data to window manager
         WindowManager &manager( *static_cast<WindowManager*>(data ) );
 
+        static const Gtk::TypeName pathBarType( "GtkPathBar" );
         bool registered( false );
-        if( GTK_IS_WINDOW( widget ) ||
-            GTK_IS_VIEWPORT( widget ) ||
-            GTK_IS_TOOLBAR( widget ) ||
-            GTK_IS_MENU_BAR( widget ) ||
-            GTK_IS_NOTEBOOK( widget ) )
+        if( flags & Gtk::TypeFlags::WindowManagerWidget )
         {
 
             // top-level windows
@@ -377,7 +379,7 @@ namespace Oxygen
 
         } else if(
             Gtk::gtk_button_is_in_path_bar(widget) &&
-            Gtk::g_object_is_a( G_OBJECT( gtk_widget_get_parent( widget ) ),  "GtkPathBar" ) ) {
+            Gtk::g_object_is_a( G_OBJECT( gtk_widget_get_parent( widget ) ), pathBarType ) ) {
 
             // path bar widgets
             registered = manager.registerWidget( widget );
@@ -801,7 +803,7 @@ namespace Oxygen
         if( iter == _blackList.end() ) return false;
         else {
 
-            std::cerr << "Oxygen::WindowManager::widgetIsBlackListed - widget: " << widget << " type: " << *iter << std::endl;
+            std::cerr << "Oxygen::WindowManager::widgetIsBlackListed - widget: " << widget << " type: " << iter->name() << std::endl;
             return true;
 
         }
@@ -830,15 +832,15 @@ namespace Oxygen
     {
         // clear list
         _blackList.clear();
-        _blackList.push_back( "GtkScale" );
-        _blackList.push_back( "GimpColorBar" );
-        _blackList.push_back( "GladeDesignLayout" );
-        _blackList.push_back( "GooCanvas" );
-        _blackList.push_back( "GtkPizza" );
-        _blackList.push_back( "MetaFrames" );
-        _blackList.push_back( "SPHRuler" );
-        _blackList.push_back( "SPVRuler" );
-        _blackList.push_back( "GtkPlug" );
+        _blackList.push_back( Gtk::TypeName( "GtkScale" ) );
+        _blackList.push_back( Gtk::TypeName( "GimpColorBar" ) );
+        _blackList.push_back( Gtk::TypeName( "GladeDesignLayout" ) );
+        _blackList.push_back( Gtk::TypeName( "GooCanvas" ) );
+        _blackList.push_back( Gtk::TypeName( "GtkPizza" ) );
+        _blackList.push_back( Gtk::TypeName( "MetaFrames" ) );
+        _blackList.push_back( Gtk::TypeName( "SPHRuler" ) );
+        _blackList.push_back( Gtk::TypeName( "SPVRuler" ) );
+        _blackList.push_back( Gtk::TypeName( "GtkPlug" ) );
     }
 
     //________________________________________________________________________________
@@ -190,8 +190,8 @@ namespace Oxygen
                 {}
 
             //! predicate
-            bool operator() (const std::string& objectName ) const
-            { return Gtk::g_object_is_a( _object, objectName ); }
+            bool operator() (const Gtk::TypeName& typeName ) const
+            { return Gtk::g_object_is_a( _object, typeName ); }
 
             private:
 
@@ -300,7 +300,7 @@ namespace Oxygen
         guint32 _time;
 
         //! widget typenames black-list
-        typedef std::vector<std::string> BlackList;
+        typedef std::vector<Gtk::TypeName> BlackList;
         BlackList _blackList;
 
         //! widget black-list
@@ -68,6 +68,14 @@ namespace Oxygen
             return std::max(size,5.0);
         }
 
+        //! active shadow configuration
+        const ShadowConfiguration& activeShadowConfiguration( void ) const
+        { return activeShadowConfiguration_; }
+
+        //! inactive shadow configuration
+        const ShadowConfiguration& inactiveShadowConfiguration( void ) const
+        { return inactiveShadowConfiguration_; }
+
         //! overlap between shadow pixmap and contents body
         enum { Overlap = 4 };
 
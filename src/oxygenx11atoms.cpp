@@ -0,0 +1,219 @@
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include "oxygenx11atoms.h"
+#include "config.h"
+
+#include <iostream>
+
+#ifdef GDK_WINDOWING_X11
+#include <gdk/gdkx.h>
+#include <X11/Xatom.h>
+#endif
+
+namespace Oxygen
+{
+
+    #ifdef GDK_WINDOWING_X11
+
+    //____________________________________________________________________
+    const char* const X11Atoms::_atomNames[X11Atoms::AtomCount] =
+    {
+        "_NET_SUPPORTED",
+        "_KDE_NET_WM_SHADOW",
+        "_KDE_NET_WM_BLUR_BEHIND_REGION",
+        "_KDE_OXYGEN_BACKGROUND_GRADIENT",
+        "_KDE_OXYGEN_BACKGROUND_PIXMAP",
+        "_OXYGEN_GTK_SHADOW_PIXMAPS"
+    };
+
+    //____________________________________________________________________
+    X11Atoms* X11Atoms::_instance = 0L;
+    X11Atoms& X11Atoms::instance( void )
+    {
+
+        if( !_instance )
+        { _instance = new X11Atoms(); }
+
+        return *_instance;
+    }
+
+    //____________________________________________________________________
+    X11Atoms::X11Atoms( void ):
+        _initialized( false ),
+        _display( 0L ),
+        _rootWindow( 0L ),
+        _supportedAtomsValid( false )
+    {
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::X11Atoms::X11Atoms" << std::endl;
+        #endif
+
+        for( int i = 0; i < AtomCount; ++i )
+        { _atoms[i] = None; }
+
+    }
+
+    //____________________________________________________________________
+    X11Atoms::~X11Atoms( void )
+    {
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::X11Atoms::~X11Atoms" << std::endl;
+        #endif
+
+        // remove root window filter
+        if( _rootWindow )
+        { gdk_window_remove_filter( _rootWindow, (GdkFilterFunc)rootWindowFilter, this ); }
+
+        _instance = 0L;
+
+    }
+
+    //____________________________________________________________________
+    Atom X11Atoms::atom( AtomId id )
+    {
+        if( !initialize() ) return None;
+        return _atoms[id];
+    }
+
+    //____________________________________________________________________
+    bool X11Atoms::isSupported( AtomId id )
+    {
+
+        if( !initialize() ) return false;
+        if( !_supportedAtomsValid ) loadSupportedAtoms();
+        return _atoms[id] != None && _supportedAtoms.find( _atoms[id] ) != _supportedAtoms.end();
+
+    }
+
+    //____________________________________________________________________
+    bool X11Atoms::initialize( void )
+    {
+
+        if( _initialized ) return true;
+
+        // get screen and check
+        GdkScreen* screen = gdk_screen_get_default();
+        if( !screen ) return false;
+
+        // get display and check
+        Display* display( GDK_DISPLAY_XDISPLAY( gdk_screen_get_display( screen ) ) );
+        if( !display ) return false;
+
+        // intern all atoms at once
+        if( !XInternAtoms( display, const_cast<char**>( _atomNames ), AtomCount, False, _atoms ) )
+        {
+
+            #if OXYGEN_DEBUG
+            std::cerr << "Oxygen::X11Atoms::initialize - failed to intern atoms" << std::endl;
+            #endif
+
+            return false;
+
+        }
+
+        _display = display;
+
+        // track _NET_SUPPORTED changes on root window
+        _rootWindow = gdk_screen_get_root_window( screen );
+        gdk_window_set_events( _rootWindow, GdkEventMask( gdk_window_get_events( _rootWindow ) | GDK_PROPERTY_CHANGE_MASK ) );
+        gdk_window_add_filter( _rootWindow, (GdkFilterFunc)rootWindowFilter, this );
+
+        _initialized = true;
+        return true;
+
+    }
+
+    //____________________________________________________________________
+    void X11Atoms::loadSupportedAtoms( void )
+    {
+
+        #if OXYGEN_DEBUG
+        std::cerr << "Oxygen::X11Atoms::loadSupportedAtoms" << std::endl;
+        #endif
+
+        _supportedAtoms.clear();
+        _supportedAtomsValid = true;
+
+        // root window
+        const Window root( GDK_WINDOW_XID( _rootWindow ) );
+        if( !root ) return;
+
+        Atom type;
+        int format;
+        unsigned char *data;
+        unsigned long count;
+        unsigned long after;
+        int length = 32768;
+
+        while( true )
+        {
+
+            // get atom property on root window
+            // length is incremented until after is zero
+            if( XGetWindowProperty(
+                _display, root,
+                _atoms[NetSupported], 0l, length,
+                false, XA_ATOM, &type,
+                &format, &count, &after, &data) != Success ) return;
+
+            if( after == 0 ) break;
+
+            // free data, increase length
+            XFree( data );
+            length *= 2;
+            continue;
+
+        }
+
+        if( !data ) return;
+
+        // store atoms
+        const Atom* atoms = reinterpret_cast<Atom*>( data );
+        _supportedAtoms.insert( atoms, atoms + count );
+        XFree( data );
+
+    }
+
+    //____________________________________________________________________
+    GdkFilterReturn X11Atoms::rootWindowFilter( GdkXEvent* gdkXEvent, GdkEvent*, gpointer pointer )
+    {
+
+        X11Atoms& atoms( *static_cast<X11Atoms*>( pointer ) );
+        const XEvent* xEvent( static_cast<XEvent*>( gdkXEvent ) );
+        if( xEvent->type == PropertyNotify && xEvent->xproperty.atom == atoms._atoms[NetSupported] )
+        {
+
+            #if OXYGEN_DEBUG
+            std::cerr << "Oxygen::X11Atoms::rootWindowFilter - _NET_SUPPORTED changed" << std::endl;
+            #endif
+
+            atoms._supportedAtomsValid = false;
+
+        }
+
+        return GDK_FILTER_CONTINUE;
+
+    }
+
+    #endif
+
+}
@@ -0,0 +1,119 @@
+#ifndef oxygenx11atoms_h
+#define oxygenx11atoms_h
+/*
+* this file is part of the oxygen gtk engine
+* Copyright (c) 2012 Hugo Pereira Da Costa <hugo.pereira@free.fr>
+*
+* This  library is free  software; you can  redistribute it and/or
+* modify it  under  the terms  of the  GNU Lesser  General  Public
+* License  as published  by the Free  Software  Foundation; either
+* version 2 of the License, or(at your option ) any later version.
+*
+* This library is distributed  in the hope that it will be useful,
+* but  WITHOUT ANY WARRANTY; without even  the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License  along  with  this library;  if not,  write to  the Free
+* Software Foundation, Inc., 51  Franklin St, Fifth Floor, Boston,
+* MA 02110-1301, USA.
+*/
+
+#include <gtk/gtk.h>
+#include <set>
+
+#ifdef GDK_WINDOWING_X11
+#include <X11/Xdefs.h>
+#include <X11/Xlib.h>
+#endif
+
+namespace Oxygen
+{
+
+    #ifdef GDK_WINDOWING_X11
+
+    //! interns all X11 atoms used by the engine, and caches root window _NET_SUPPORTED property
+    /*!
+    all atoms are interned in a single XInternAtoms request, the first time one is needed.
+    The content of _NET_SUPPORTED is read once, and re-read only after a PropertyNotify
+    event was received for it on the root window
+    */
+    class X11Atoms
+    {
+
+        public:
+
+        //! singleton
+        static X11Atoms& instance( void );
+
+        //! destructor
+        virtual ~X11Atoms( void );
+
+        //! atom ids
+        enum AtomId
+        {
+            NetSupported,
+            NetWMShadow,
+            BlurBehindRegion,
+            BackgroundGradient,
+            BackgroundPixmap,
+            ShadowPixmaps,
+            AtomCount
+        };
+
+        //! atom
+        /*! returns None if atoms could not be interned */
+        Atom atom( AtomId );
+
+        //! true if atom is listed in the root window _NET_SUPPORTED property
+        bool isSupported( AtomId );
+
+        protected:
+
+        //! intern all atoms
+        bool initialize( void );
+
+        //! read _NET_SUPPORTED property from root window
+        void loadSupportedAtoms( void );
+
+        //! root window event filter, to track _NET_SUPPORTED changes
+        static GdkFilterReturn rootWindowFilter( GdkXEvent*, GdkEvent*, gpointer );
+
+        private:
+
+        //! constructor is private
+        X11Atoms( void );
+
+        //! atom names, indexed by AtomId
+        static const char* const _atomNames[AtomCount];
+
+        //! true when atoms have been interned
+        bool _initialized;
+
+        //! display
+        Display* _display;
+
+        //! root window
+        GdkWindow* _rootWindow;
+
+        //! interned atoms, indexed by AtomId
+        Atom _atoms[AtomCount];
+
+        //! true when supported atoms are up to date
+        bool _supportedAtomsValid;
+
+        //! atoms listed in _NET_SUPPORTED
+        typedef std::set<Atom> AtomSet;
+        AtomSet _supportedAtoms;
+
+        //! singleton
+        static X11Atoms* _instance;
+
+    };
+
+    #endif
+
+}
+
+#endif